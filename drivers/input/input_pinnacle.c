@@ -4,6 +4,18 @@
 #include <zephyr/init.h>
 #include <zephyr/input/input.h>
 #include <zephyr/pm/device.h>
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_SETTINGS) || IS_ENABLED(CONFIG_INPUT_PINNACLE_CAL_CACHE)
+#include <zephyr/settings/settings.h>
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_CAL_CACHE)
+#include <zephyr/sys/crc.h>
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_TRACE)
+#include <zephyr/sys/byteorder.h>
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_STATS_SHELL) || IS_ENABLED(CONFIG_INPUT_PINNACLE_TRACE_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
 
 #include <zephyr/logging/log.h>
 
@@ -11,16 +23,119 @@
 
 LOG_MODULE_REGISTER(pinnacle, CONFIG_INPUT_LOG_LEVEL);
 
-static int pinnacle_seq_read(const struct device *dev, const uint8_t addr, uint8_t *buf,
-                             const uint8_t len) {
-    const struct pinnacle_config *config = dev->config;
-    return config->seq_read(dev, addr, buf, len);
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_STATS)
+
+STATS_NAME_START(pinnacle)
+STATS_NAME(pinnacle, interrupts)
+STATS_NAME(pinnacle, reports)
+STATS_NAME(pinnacle, comm_failures)
+STATS_NAME(pinnacle, spurious)
+STATS_NAME(pinnacle, bus_errors)
+STATS_NAME(pinnacle, era_wait_loops)
+STATS_NAME_END(pinnacle);
+
+// Also used from the DR ISR, hence a spinlock rather than the device mutex
+#define PINNACLE_STATS_INC(dev, var)                                                               \
+    do {                                                                                           \
+        struct pinnacle_data *_data = (dev)->data;                                                 \
+        k_spinlock_key_t _key = k_spin_lock(&_data->stats_lock);                                   \
+                                                                                                   \
+        STATS_INC(_data->stats, var);                                                              \
+        k_spin_unlock(&_data->stats_lock, _key);                                                   \
+    } while (0)
+
+static void pinnacle_hist_add(struct pinnacle_data *data, struct pinnacle_hist *hist,
+                              uint32_t us) {
+    size_t i = 0;
+
+    for (us >>= PINNACLE_HIST_SHIFT; us && i < PINNACLE_HIST_BUCKETS - 1; us >>= 1) {
+        i++;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+    hist->buckets[i]++;
+    k_spin_unlock(&data->stats_lock, key);
 }
-static int pinnacle_write(const struct device *dev, const uint8_t addr, const uint8_t val) {
+
+static inline uint32_t pinnacle_stats_bus_start(void) { return k_cycle_get_32(); }
+
+static void pinnacle_stats_bus_done(const struct device *dev, uint32_t start, int ret) {
+    struct pinnacle_data *data = dev->data;
+
+    if (ret < 0) {
+        PINNACLE_STATS_INC(dev, bus_errors);
+        return;
+    }
+
+    pinnacle_hist_add(data, &data->bus_xfer, k_cyc_to_us_floor32(k_cycle_get_32() - start));
+}
+
+static void pinnacle_stats_report(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+
+    PINNACLE_STATS_INC(dev, reports);
+
+    // Drained packets, watchdog recoveries and resubmits have no edge of their own to measure from
+    if (!atomic_test_and_clear_bit(&data->flags, PINNACLE_FLAG_REPORT_STAMPED)) {
+        return;
+    }
+
+    pinnacle_hist_add(data, &data->dr_to_report,
+                      k_cyc_to_us_floor32(k_cycle_get_32() - data->dr_cycles));
+}
+
+#else
+
+// Compiles away entirely, so the hot path is unchanged without CONFIG_INPUT_PINNACLE_STATS
+#define PINNACLE_STATS_INC(dev, var)                                                               \
+    do {                                                                                           \
+    } while (0)
+
+static inline uint32_t pinnacle_stats_bus_start(void) { return 0; }
+static inline void pinnacle_stats_bus_done(const struct device *dev, uint32_t start, int ret) {}
+static inline void pinnacle_stats_report(const struct device *dev) {}
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_STATS)
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_TRACE)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_INPUT_PINNACLE_TRACE_LEN),
+             "CONFIG_INPUT_PINNACLE_TRACE_LEN must be a power of two");
+
+#define PINNACLE_TRACE_MASK (CONFIG_INPUT_PINNACLE_TRACE_LEN - 1)
+
+// The head only moves under trace_lock, so readers and clears never see a half-written entry
+static void pinnacle_trace_capture(const struct device *dev, uint8_t status,
+                                   const uint8_t *packet) {
     const struct pinnacle_config *config = dev->config;
-    return config->write(dev, addr, val);
+    struct pinnacle_data *data = dev->data;
+    uint32_t time_us = (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks());
+    k_spinlock_key_t key = k_spin_lock(&data->trace_lock);
+    uint32_t idx = data->trace_head++;
+    struct pinnacle_trace_entry *entry = &data->trace[idx & PINNACLE_TRACE_MASK];
+
+    entry->time_us = time_us;
+    entry->seq = (uint8_t)idx;
+    entry->status = status;
+    memset(entry->packet, 0, sizeof(entry->packet));
+    if (packet) {
+        memcpy(entry->packet, packet, config->packet_len);
+    }
+    k_spin_unlock(&data->trace_lock, key);
 }
 
+#else
+
+static inline void pinnacle_trace_capture(const struct device *dev, uint8_t status,
+                                          const uint8_t *packet) {}
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_TRACE)
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+static void pinnacle_async_cb(const struct device *bus, int result, void *user_data);
+#endif
+
 #if DT_ANY_INST_ON_BUS_STATUS_OKAY(i2c)
 
 static int pinnacle_i2c_seq_read(const struct device *dev, const uint8_t addr, uint8_t *buf,
@@ -34,88 +149,378 @@ static int pinnacle_i2c_write(const struct device *dev, const uint8_t addr, cons
     return i2c_reg_write_byte_dt(&config->bus.i2c, PINNACLE_WRITE | addr, val);
 }
 
-#endif // DT_ANY_INST_ON_BUS_STATUS_OKAY(i2c)
+// Each write is its own STOP-terminated message, all in one transfer
+static int pinnacle_i2c_write_seq(const struct device *dev, const struct pinnacle_reg_write *writes,
+                                  const size_t count) {
+    const struct pinnacle_config *config = dev->config;
+    struct i2c_msg msgs[PINNACLE_WRITE_SEQ_MAX];
+    uint8_t bufs[PINNACLE_WRITE_SEQ_MAX][2];
 
-#if DT_ANY_INST_ON_BUS_STATUS_OKAY(spi)
+    if (count > PINNACLE_WRITE_SEQ_MAX) {
+        return -EINVAL;
+    }
 
-static int pinnacle_spi_seq_read(const struct device *dev, const uint8_t addr, uint8_t *buf,
-                                 const uint8_t len) {
+    for (size_t i = 0; i < count; i++) {
+        bufs[i][0] = PINNACLE_WRITE | writes[i].addr;
+        bufs[i][1] = writes[i].val;
+        msgs[i].buf = bufs[i];
+        msgs[i].len = 2;
+        msgs[i].flags = I2C_MSG_WRITE | I2C_MSG_STOP;
+    }
+
+    return i2c_transfer_dt(&config->bus.i2c, msgs, count);
+}
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC) && IS_ENABLED(CONFIG_I2C_CALLBACK)
+
+static int pinnacle_i2c_async_read(const struct device *dev, const uint8_t addr,
+                                   const uint8_t len) {
     const struct pinnacle_config *config = dev->config;
-    uint8_t tx_buffer[len + 3], rx_dummy[3];
-    tx_buffer[0] = PINNACLE_READ | addr;
-    memset(&tx_buffer[1], PINNACLE_AUTOINC, len + 2);
+    struct pinnacle_data *data = dev->data;
+    struct i2c_msg *msgs = data->async_xfer.i2c;
 
-    const struct spi_buf tx_buf[2] = {
-        {
-            .buf = tx_buffer,
-            .len = len + 3,
-        },
-    };
-    const struct spi_buf_set tx = {
-        .buffers = tx_buf,
-        .count = 1,
-    };
-    struct spi_buf rx_buf[2] = {
-        {
-            .buf = rx_dummy,
-            .len = 3,
-        },
-        {
-            .buf = buf,
-            .len = len,
-        },
-    };
-    const struct spi_buf_set rx = {
-        .buffers = rx_buf,
-        .count = 2,
-    };
-    int ret = spi_transceive_dt(&config->bus.spi, &tx, &rx);
+    data->async_bufs.tx[0] = PINNACLE_READ | addr;
+    msgs[0].buf = data->async_bufs.tx;
+    msgs[0].len = 1;
+    msgs[0].flags = I2C_MSG_WRITE;
+    msgs[1].buf = &data->async_bufs.regs[addr - PINNACLE_STATUS1];
+    msgs[1].len = len;
+    msgs[1].flags = I2C_MSG_RESTART | I2C_MSG_READ | I2C_MSG_STOP;
 
-    return ret;
+    return i2c_transfer_cb_dt(&config->bus.i2c, msgs, 2, pinnacle_async_cb, (void *)dev);
 }
 
-static int pinnacle_spi_write(const struct device *dev, const uint8_t addr, const uint8_t val) {
+static int pinnacle_i2c_async_write(const struct device *dev, const uint8_t addr,
+                                    const uint8_t val) {
     const struct pinnacle_config *config = dev->config;
-    uint8_t tx_buffer[2] = {PINNACLE_WRITE | addr, val};
-    uint8_t rx_buffer[2];
+    struct pinnacle_data *data = dev->data;
+    struct i2c_msg *msgs = data->async_xfer.i2c;
+
+    data->async_bufs.tx[0] = PINNACLE_WRITE | addr;
+    data->async_bufs.tx[1] = val;
+    msgs[0].buf = data->async_bufs.tx;
+    msgs[0].len = 2;
+    msgs[0].flags = I2C_MSG_WRITE | I2C_MSG_STOP;
+
+    return i2c_transfer_cb_dt(&config->bus.i2c, msgs, 1, pinnacle_async_cb, (void *)dev);
+}
+
+#define PINNACLE_I2C_ASYNC_OPS                                                                     \
+    , .async_read = pinnacle_i2c_async_read, .async_write = pinnacle_i2c_async_write
 
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC) && IS_ENABLED(CONFIG_I2C_CALLBACK)
+
+#endif // DT_ANY_INST_ON_BUS_STATUS_OKAY(i2c)
+
+#if DT_ANY_INST_ON_BUS_STATUS_OKAY(spi)
+
+// Full duplex over the per-instance buffers; the caller holds the buffer lock
+static int pinnacle_spi_xfer(const struct pinnacle_config *config, size_t len) {
+    struct pinnacle_spi_bufs *bufs = config->spi_bufs;
     const struct spi_buf tx_buf = {
-        .buf = tx_buffer,
-        .len = 2,
+        .buf = bufs->tx,
+        .len = len,
     };
     const struct spi_buf_set tx = {
         .buffers = &tx_buf,
         .count = 1,
     };
-
     const struct spi_buf rx_buf = {
-        .buf = rx_buffer,
-        .len = 2,
+        .buf = bufs->rx,
+        .len = len,
     };
     const struct spi_buf_set rx = {
         .buffers = &rx_buf,
         .count = 1,
     };
 
-    const int ret = spi_transceive_dt(&config->bus.spi, &tx, &rx);
+    return spi_transceive_dt(&config->bus.spi, &tx, &rx);
+}
+
+static int pinnacle_spi_seq_read(const struct device *dev, const uint8_t addr, uint8_t *buf,
+                                 const uint8_t len) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_spi_bufs *bufs = config->spi_bufs;
+
+    if (len + 3 > sizeof(bufs->tx)) {
+        return -EINVAL;
+    }
+
+    k_mutex_lock(&bufs->lock, K_FOREVER);
+
+    bufs->tx[0] = PINNACLE_READ | addr;
+    memset(&bufs->tx[1], PINNACLE_AUTOINC, len + 2);
+
+    int ret = pinnacle_spi_xfer(config, len + 3);
+    if (ret >= 0) {
+        memcpy(buf, &bufs->rx[3], len);
+    }
+
+    k_mutex_unlock(&bufs->lock);
+
+    return ret;
+}
+
+static int pinnacle_spi_write_locked(const struct pinnacle_config *config, const uint8_t addr,
+                                     const uint8_t val) {
+    struct pinnacle_spi_bufs *bufs = config->spi_bufs;
+
+    bufs->tx[0] = PINNACLE_WRITE | addr;
+    bufs->tx[1] = val;
 
+    const int ret = pinnacle_spi_xfer(config, 2);
     if (ret < 0) {
         LOG_ERR("spi ret: %d", ret);
+        return ret;
     }
 
-    if (rx_buffer[1] != PINNACLE_FILLER) {
-        LOG_ERR("bad ret val %d - %d", rx_buffer[0], rx_buffer[1]);
+    if (bufs->rx[1] != PINNACLE_FILLER) {
+        LOG_ERR("bad ret val %d - %d", bufs->rx[0], bufs->rx[1]);
         return -EIO;
     }
 
-    k_usleep(50);
+    return ret;
+}
+
+/*
+ * Configuration registers need time to take effect before the next access. STATUS1 clears and
+ * ERA accesses don't: the latter are followed by a poll of ERA_CONTROL anyway.
+ */
+static bool pinnacle_spi_write_needs_settle(const uint8_t addr) {
+    return addr >= PINNACLE_SYS_CFG && addr <= PINNACLE_SLEEP_TIMER;
+}
+
+static int pinnacle_spi_write(const struct device *dev, const uint8_t addr, const uint8_t val) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_spi_bufs *bufs = config->spi_bufs;
+
+    k_mutex_lock(&bufs->lock, K_FOREVER);
+    int ret = pinnacle_spi_write_locked(config, addr, val);
+    k_mutex_unlock(&bufs->lock);
+
+    if (ret >= 0 && pinnacle_spi_write_needs_settle(addr)) {
+        k_usleep(50);
+    }
+
+    return ret;
+}
+
+// One CS cycle per write, but a single buffer lock and at most one settle delay for the chain
+static int pinnacle_spi_write_seq(const struct device *dev, const struct pinnacle_reg_write *writes,
+                                  const size_t count) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_spi_bufs *bufs = config->spi_bufs;
+    bool settle = false;
+    int ret = 0;
+
+    k_mutex_lock(&bufs->lock, K_FOREVER);
+    for (size_t i = 0; i < count && ret >= 0; i++) {
+        ret = pinnacle_spi_write_locked(config, writes[i].addr, writes[i].val);
+        settle |= pinnacle_spi_write_needs_settle(writes[i].addr);
+    }
+    k_mutex_unlock(&bufs->lock);
+
+    if (ret >= 0 && settle) {
+        k_usleep(50);
+    }
 
     return ret;
 }
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC) && IS_ENABLED(CONFIG_SPI_ASYNC)
+
+static int pinnacle_spi_async_read(const struct device *dev, const uint8_t addr,
+                                   const uint8_t len) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_data *data = dev->data;
+    struct pinnacle_spi_async_xfer *xfer = &data->async_xfer.spi;
+
+    data->async_bufs.tx[0] = PINNACLE_READ | addr;
+    memset(&data->async_bufs.tx[1], PINNACLE_AUTOINC, len + 2);
+
+    xfer->tx_buf.buf = data->async_bufs.tx;
+    xfer->tx_buf.len = len + 3;
+    xfer->tx.buffers = &xfer->tx_buf;
+    xfer->tx.count = 1;
+
+    xfer->rx_buf[0].buf = data->async_bufs.rx;
+    xfer->rx_buf[0].len = 3;
+    xfer->rx_buf[1].buf = &data->async_bufs.regs[addr - PINNACLE_STATUS1];
+    xfer->rx_buf[1].len = len;
+    xfer->rx.buffers = xfer->rx_buf;
+    xfer->rx.count = 2;
+
+    return spi_transceive_cb(config->bus.spi.bus, &config->bus.spi.config, &xfer->tx, &xfer->rx,
+                             pinnacle_async_cb, (void *)dev);
+}
+
+static int pinnacle_spi_async_write(const struct device *dev, const uint8_t addr,
+                                    const uint8_t val) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_data *data = dev->data;
+    struct pinnacle_spi_async_xfer *xfer = &data->async_xfer.spi;
+
+    // No post-write settle delay here; STATUS1 clears are the only async writes
+    data->async_bufs.tx[0] = PINNACLE_WRITE | addr;
+    data->async_bufs.tx[1] = val;
+
+    xfer->tx_buf.buf = data->async_bufs.tx;
+    xfer->tx_buf.len = 2;
+    xfer->tx.buffers = &xfer->tx_buf;
+    xfer->tx.count = 1;
+
+    xfer->rx_buf[0].buf = data->async_bufs.rx;
+    xfer->rx_buf[0].len = 2;
+    xfer->rx.buffers = xfer->rx_buf;
+    xfer->rx.count = 1;
+
+    return spi_transceive_cb(config->bus.spi.bus, &config->bus.spi.config, &xfer->tx, &xfer->rx,
+                             pinnacle_async_cb, (void *)dev);
+}
+
+#define PINNACLE_SPI_ASYNC_OPS                                                                     \
+    , .async_read = pinnacle_spi_async_read, .async_write = pinnacle_spi_async_write
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC) && IS_ENABLED(CONFIG_SPI_ASYNC)
+
 #endif // DT_ANY_INST_ON_BUS_STATUS_OKAY(spi)
 
+#if PINNACLE_BUS_MIXED
+
+#ifndef PINNACLE_I2C_ASYNC_OPS
+#define PINNACLE_I2C_ASYNC_OPS
+#endif
+
+#ifndef PINNACLE_SPI_ASYNC_OPS
+#define PINNACLE_SPI_ASYNC_OPS
+#endif
+
+#define PINNACLE_I2C_OPS                                                                           \
+    , .seq_read = pinnacle_i2c_seq_read, .write = pinnacle_i2c_write,                              \
+      .write_seq = pinnacle_i2c_write_seq PINNACLE_I2C_ASYNC_OPS
+#define PINNACLE_SPI_OPS                                                                           \
+    , .seq_read = pinnacle_spi_seq_read, .write = pinnacle_spi_write,                              \
+      .write_seq = pinnacle_spi_write_seq PINNACLE_SPI_ASYNC_OPS
+
+#define PINNACLE_BUS_OP(dev, op) (((const struct pinnacle_config *)(dev)->config)->op)
+#define PINNACLE_BUS_ASYNC_OP(dev, op) PINNACLE_BUS_OP(dev, op)
+
+#else
+
+#define PINNACLE_I2C_OPS
+#define PINNACLE_SPI_OPS
+
+#if PINNACLE_BUS_SPI
+#define PINNACLE_BUS_OP(dev, op) pinnacle_spi_##op
+#if defined(PINNACLE_SPI_ASYNC_OPS)
+#define PINNACLE_BUS_ASYNC_OP(dev, op) PINNACLE_BUS_OP(dev, op)
+#endif
+#else
+#define PINNACLE_BUS_OP(dev, op) pinnacle_i2c_##op
+#if defined(PINNACLE_I2C_ASYNC_OPS)
+#define PINNACLE_BUS_ASYNC_OP(dev, op) PINNACLE_BUS_OP(dev, op)
+#endif
+#endif
+
+// Without callback transfers on the bus the async ops report -ENOTSUP
+#ifndef PINNACLE_BUS_ASYNC_OP
+#define PINNACLE_BUS_ASYNC_OP(dev, op) NULL
+#endif
+
+#endif // PINNACLE_BUS_MIXED
+
+static int pinnacle_seq_read(const struct device *dev, const uint8_t addr, uint8_t *buf,
+                             const uint8_t len) {
+    uint32_t start = pinnacle_stats_bus_start();
+    int ret = PINNACLE_BUS_OP(dev, seq_read)(dev, addr, buf, len);
+
+    pinnacle_stats_bus_done(dev, start, ret);
+    return ret;
+}
+static int pinnacle_write(const struct device *dev, const uint8_t addr, const uint8_t val) {
+    uint32_t start = pinnacle_stats_bus_start();
+    int ret = PINNACLE_BUS_OP(dev, write)(dev, addr, val);
+
+    pinnacle_stats_bus_done(dev, start, ret);
+    return ret;
+}
+static int pinnacle_write_seq(const struct device *dev, const struct pinnacle_reg_write *writes,
+                              const size_t count) {
+    uint32_t start = pinnacle_stats_bus_start();
+    int ret = PINNACLE_BUS_OP(dev, write_seq)(dev, writes, count);
+
+    pinnacle_stats_bus_done(dev, start, ret);
+    return ret;
+}
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_WORKQUEUE)
+
+K_THREAD_STACK_DEFINE(pinnacle_work_q_stack, CONFIG_INPUT_PINNACLE_WORKQUEUE_STACK_SIZE);
+static struct k_work_q pinnacle_work_q;
+
+// Shared by all instances; started by whichever instance initializes first
+static void pinnacle_work_q_start(void) {
+    static bool started;
+
+    if (started) {
+        return;
+    }
+
+    const struct k_work_queue_config cfg = {
+        .name = "pinnacle_wq",
+    };
+
+    k_work_queue_init(&pinnacle_work_q);
+    k_work_queue_start(&pinnacle_work_q, pinnacle_work_q_stack,
+                       K_THREAD_STACK_SIZEOF(pinnacle_work_q_stack),
+                       CONFIG_INPUT_PINNACLE_WORKQUEUE_PRIORITY, &cfg);
+    started = true;
+}
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_WORKQUEUE)
+
+static int pinnacle_submit_work(struct k_work *work) {
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_WORKQUEUE)
+    return k_work_submit_to_queue(&pinnacle_work_q, work);
+#else
+    return k_work_submit(work);
+#endif
+}
+
+static int pinnacle_schedule_work(struct k_work_delayable *dwork, k_timeout_t delay) {
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_WORKQUEUE)
+    return k_work_schedule_for_queue(&pinnacle_work_q, dwork, delay);
+#else
+    return k_work_schedule(dwork, delay);
+#endif
+}
+
+// True on the thread running the driver's work items, where waiting for one would deadlock
+static bool pinnacle_on_work_queue(void) {
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_WORKQUEUE)
+    return k_current_get() == k_work_queue_thread_get(&pinnacle_work_q);
+#else
+    return k_current_get() == k_work_queue_thread_get(&k_sys_work_q);
+#endif
+}
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_POLL)
+static void pinnacle_poll_enable(const struct device *dev, bool en);
+#endif
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_TRACE)
+static int pinnacle_run_sync(const struct device *dev, pinnacle_sync_fn_t fn, const void *arg);
+#endif
+
 static int set_int(const struct device *dev, const bool en) {
     const struct pinnacle_config *config = dev->config;
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_POLL)
+    // Without a DR line the poll timer stands in for the interrupt
+    if (!config->dr.port) {
+        pinnacle_poll_enable(dev, en);
+        return 0;
+    }
+#endif
     int ret = gpio_pin_interrupt_configure_dt(&config->dr,
                                               en ? GPIO_INT_EDGE_TO_ACTIVE : GPIO_INT_DISABLE);
     if (ret < 0) {
@@ -125,6 +530,11 @@ static int set_int(const struct device *dev, const bool en) {
     return ret;
 }
 
+// Always false without a DR line, which keeps the DR checks inert in polling mode
+static bool pinnacle_dr_asserted(const struct pinnacle_config *config) {
+    return config->dr.port && gpio_pin_get_dt(&config->dr) > 0;
+}
+
 static int pinnacle_clear_status(const struct device *dev) {
     int ret = pinnacle_write(dev, PINNACLE_STATUS1, 0);
     if (ret < 0) {
@@ -134,128 +544,520 @@ static int pinnacle_clear_status(const struct device *dev) {
     return ret;
 }
 
-static int pinnacle_era_read(const struct device *dev, const uint16_t addr, uint8_t *val) {
-    int ret;
+static void pinnacle_shadow_invalidate(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
 
-    set_int(dev, false);
+    atomic_set(&data->shadow.valid, 0);
+}
+
+// Loads every shadowed register with one auto-increment read
+static int pinnacle_shadow_load(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+    struct pinnacle_shadow *shadow = &data->shadow;
 
-    ret = pinnacle_write(dev, PINNACLE_REG_ERA_HIGH_BYTE, (uint8_t)(addr >> 8));
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    int ret = pinnacle_seq_read(dev, PINNACLE_SHADOW_FIRST, shadow->regs, PINNACLE_SHADOW_LEN);
     if (ret < 0) {
-        LOG_ERR("Failed to write ERA high byte (%d)", ret);
-        return -EIO;
+        LOG_ERR("Failed to load register shadow %d", ret);
+        pinnacle_shadow_invalidate(dev);
+    } else {
+        atomic_set(&shadow->valid, BIT_MASK(PINNACLE_SHADOW_LEN));
+        shadow->stats.resyncs++;
     }
 
-    ret = pinnacle_write(dev, PINNACLE_REG_ERA_LOW_BYTE, (uint8_t)(addr & 0x00FF));
-    if (ret < 0) {
-        LOG_ERR("Failed to write ERA low byte (%d)", ret);
-        return -EIO;
+    k_mutex_unlock(&data->lock);
+    return ret < 0 ? ret : 0;
+}
+
+// Writes reg unless the shadow shows it already holds val
+static int pinnacle_cached_write(const struct device *dev, const uint8_t reg, const uint8_t val) {
+    struct pinnacle_data *data = dev->data;
+    struct pinnacle_shadow *shadow = &data->shadow;
+    const int idx = reg - PINNACLE_SHADOW_FIRST;
+    int ret = 0;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    if (atomic_test_bit(&shadow->valid, idx) && shadow->regs[idx] == val) {
+        shadow->stats.avoided++;
+        goto out;
     }
 
-    ret = pinnacle_write(dev, PINNACLE_REG_ERA_CONTROL, PINNACLE_ERA_CONTROL_READ);
+    ret = pinnacle_write(dev, reg, val);
     if (ret < 0) {
-        LOG_ERR("Failed to write ERA control (%d)", ret);
-        return -EIO;
+        // The write may or may not have landed, so the shadow can't be trusted any more
+        atomic_clear_bit(&shadow->valid, idx);
+        goto out;
     }
 
-    uint8_t control_val;
-    do {
+    shadow->regs[idx] = val;
+    atomic_set_bit(&shadow->valid, idx);
+    ret = 0;
 
-        ret = pinnacle_seq_read(dev, PINNACLE_REG_ERA_CONTROL, &control_val, 1);
-        if (ret < 0) {
-            LOG_ERR("Failed to read ERA control (%d)", ret);
-            return -EIO;
-        }
+out:
+    k_mutex_unlock(&data->lock);
+    return ret;
+}
 
-    } while (control_val != 0x00);
+// Sets the mask bits of reg to val, only reading the register if its shadow is not valid
+static int pinnacle_cached_update(const struct device *dev, const uint8_t reg, const uint8_t mask,
+                                  const uint8_t val) {
+    struct pinnacle_data *data = dev->data;
+    struct pinnacle_shadow *shadow = &data->shadow;
+    const int idx = reg - PINNACLE_SHADOW_FIRST;
+    int ret = 0;
 
-    ret = pinnacle_seq_read(dev, PINNACLE_REG_ERA_VALUE, val, 1);
+    // Held across the read and the write, so no other update can slip in between
+    k_mutex_lock(&data->lock, K_FOREVER);
 
-    if (ret < 0) {
-        LOG_ERR("Failed to read ERA value (%d)", ret);
-        return -EIO;
+    if (!atomic_test_bit(&shadow->valid, idx)) {
+        ret = pinnacle_seq_read(dev, reg, &shadow->regs[idx], 1);
+        if (ret >= 0) {
+            atomic_set_bit(&shadow->valid, idx);
+        }
     }
 
-    ret = pinnacle_clear_status(dev);
-
-    set_int(dev, true);
+    if (ret >= 0) {
+        ret = pinnacle_cached_write(dev, reg, (shadow->regs[idx] & ~mask) | (val & mask));
+    }
 
+    k_mutex_unlock(&data->lock);
     return ret;
 }
 
-static int pinnacle_era_write(const struct device *dev, const uint16_t addr, uint8_t val) {
-    int ret;
+int pinnacle_get_shadow_stats(const struct device *dev, struct pinnacle_shadow_stats *stats) {
+    struct pinnacle_data *data = dev->data;
 
-    set_int(dev, false);
+    k_mutex_lock(&data->lock, K_FOREVER);
+    *stats = data->shadow.stats;
+    k_mutex_unlock(&data->lock);
+    return 0;
+}
 
-    ret = pinnacle_write(dev, PINNACLE_REG_ERA_VALUE, val);
-    if (ret < 0) {
-        LOG_ERR("Failed to write ERA value (%d)", ret);
-        return -EIO;
+/*
+ * Drops SW_CC when it is set, leaving SW_DR alone so a packet that arrived during ERA access or
+ * calibration is still there for the report path. The status read is skipped when DR shows
+ * neither flag is up. On return *status holds what STATUS1 read, or 0 when it was skipped.
+ */
+static int pinnacle_clear_cc(const struct device *dev, uint8_t *status) {
+    const struct pinnacle_config *config = dev->config;
+
+    *status = 0;
+    if (config->dr.port && !pinnacle_dr_asserted(config)) {
+        return 0;
     }
 
-    ret = pinnacle_write(dev, PINNACLE_REG_ERA_HIGH_BYTE, (uint8_t)(addr >> 8));
+    int ret = pinnacle_seq_read(dev, PINNACLE_STATUS1, status, 1);
     if (ret < 0) {
-        LOG_ERR("Failed to write ERA high byte (%d)", ret);
-        return -EIO;
+        LOG_ERR("Failed to read STATUS1 register: %d", ret);
+        return ret;
     }
 
-    ret = pinnacle_write(dev, PINNACLE_REG_ERA_LOW_BYTE, (uint8_t)(addr & 0x00FF));
-    if (ret < 0) {
-        LOG_ERR("Failed to write ERA low byte (%d)", ret);
-        return -EIO;
+    if (!(*status & PINNACLE_STATUS1_SW_CC)) {
+        return 0;
     }
 
-    ret = pinnacle_write(dev, PINNACLE_REG_ERA_CONTROL, PINNACLE_ERA_CONTROL_WRITE);
+    ret = pinnacle_write(dev, PINNACLE_STATUS1, *status & ~PINNACLE_STATUS1_SW_CC);
     if (ret < 0) {
-        LOG_ERR("Failed to write ERA control (%d)", ret);
-        return -EIO;
+        LOG_ERR("Failed to clear STATUS1 register: %d", ret);
     }
 
-    uint8_t control_val;
-    do {
+    return ret;
+}
 
-        ret = pinnacle_seq_read(dev, PINNACLE_REG_ERA_CONTROL, &control_val, 1);
-        if (ret < 0) {
-            LOG_ERR("Failed to read ERA control (%d)", ret);
-            return -EIO;
-        }
+/*
+ * Starts a pass of ERA access or forced calibration. Without CONFIG_INPUT_PINNACLE_WAIT_ON_DR the
+ * DR interrupt is disabled for the pass. With it, the interrupt stays armed for the whole pass and
+ * its edges wake pinnacle_wait_clear() instead of the report path.
+ */
+static void pinnacle_pass_begin(const struct device *dev) {
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_WAIT_ON_DR)
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_data *data = dev->data;
+
+    if (config->dr.port) {
+        k_sem_reset(&data->cc_sem);
+        atomic_set_bit(&data->flags, PINNACLE_FLAG_WAITING);
+        return;
+    }
+#endif
+    set_int(dev, false);
+}
 
-    } while (control_val != 0x00);
+/*
+ * Ends a pass started with pinnacle_pass_begin(). SW_CC is dropped so DR can deassert, and a
+ * packet that raised SW_DR during the pass is handed to the report work, since its edge either
+ * went to the waiter or came while the interrupt was off.
+ */
+static int pinnacle_pass_end(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+    uint8_t status;
 
-    ret = pinnacle_clear_status(dev);
+    int ret = pinnacle_clear_cc(dev, &status);
 
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_WAIT_ON_DR)
+    atomic_clear_bit(&data->flags, PINNACLE_FLAG_WAITING);
+#endif
     set_int(dev, true);
 
+    if (status & PINNACLE_STATUS1_SW_DR) {
+        data->in_int = true;
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+        atomic_set_bit(&data->async_flags, PINNACLE_ASYNC_FALLBACK);
+#endif
+        pinnacle_submit_work(&data->work);
+    }
+
     return ret;
 }
 
-static void pinnacle_report_data(const struct device *dev) {
-    const struct pinnacle_config *config = dev->config;
-    uint8_t packet[3];
+/*
+ * Waits for the ASIC to clear the mask bits in reg, which is how ERA access and forced
+ * calibration report completion. Polls back off exponentially between reads and the wait gives
+ * up with -ETIMEDOUT at the deadline. Must run inside pinnacle_pass_begin()/pinnacle_pass_end().
+ * With CONFIG_INPUT_PINNACLE_WAIT_ON_DR the sleep between polls is cut short by the DR edge that
+ * accompanies SW_CC. A completion seen on the first poll costs nothing extra; only a wait that
+ * has to sleep first drops a SW_CC left over from the previous step, so that an edge can come.
+ */
+static int pinnacle_wait_clear(const struct device *dev, const uint8_t reg, const uint8_t mask) {
+    int64_t deadline = k_uptime_get() + CONFIG_INPUT_PINNACLE_WAIT_TIMEOUT_MS;
+    uint32_t backoff_us = CONFIG_INPUT_PINNACLE_WAIT_POLL_MIN_US;
+    uint8_t val;
     int ret;
-    ret = pinnacle_seq_read(dev, PINNACLE_STATUS1, packet, 1);
-    if (ret < 0) {
-        LOG_ERR("read status: %d", ret);
-        return;
-    }
 
-    LOG_HEXDUMP_DBG(packet, 1, "Pinnacle Status1");
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_WAIT_ON_DR)
+    struct pinnacle_data *data = dev->data;
+    bool use_dr = atomic_test_bit(&data->flags, PINNACLE_FLAG_WAITING);
+    bool armed = false;
+#endif
 
-    // Ignore 0xFF packets that indicate communcation failure, or if SW_DR isn't asserted
-    if (packet[0] == 0xFF || !(packet[0] & PINNACLE_STATUS1_SW_DR)) {
-        return;
-    }
-    ret = pinnacle_seq_read(dev, PINNACLE_2_2_PACKET0, packet, 3);
-    if (ret < 0) {
-        LOG_ERR("read packet: %d", ret);
-        return;
-    }
+    while (true) {
+        ret = pinnacle_seq_read(dev, reg, &val, 1);
+        if (ret < 0) {
+            LOG_ERR("Failed to read 0x%02x while waiting (%d)", reg, ret);
+            return -EIO;
+        }
 
-    LOG_HEXDUMP_DBG(packet, 3, "Pinnacle Packets");
+        if (!(val & mask)) {
+            return 0;
+        }
 
-    struct pinnacle_data *data = dev->data;
-    uint8_t btn = packet[0] &
-                  (PINNACLE_PACKET0_BTN_PRIM | PINNACLE_PACKET0_BTN_SEC | PINNACLE_PACKET0_BTN_AUX);
+        if (reg == PINNACLE_REG_ERA_CONTROL) {
+            PINNACLE_STATS_INC(dev, era_wait_loops);
+        }
+
+        if (k_uptime_get() >= deadline) {
+            LOG_ERR("Timed out waiting on 0x%02x (0x%02x)", reg, val);
+            return -ETIMEDOUT;
+        }
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_WAIT_ON_DR)
+        if (use_dr) {
+            if (!armed) {
+                uint8_t status;
+
+                armed = true;
+                k_sem_reset(&data->cc_sem);
+                ret = pinnacle_clear_cc(dev, &status);
+                if (ret < 0) {
+                    return ret;
+                }
+                // The completion may have landed while SW_CC was being dropped
+                continue;
+            }
+            k_sem_take(&data->cc_sem, K_USEC(backoff_us));
+        } else {
+            k_usleep(backoff_us);
+        }
+#else
+        k_usleep(backoff_us);
+#endif
+        backoff_us = MIN(backoff_us * 2, CONFIG_INPUT_PINNACLE_WAIT_POLL_MAX_US);
+    }
+}
+
+static int pinnacle_era_set_addr(const struct device *dev, const uint16_t addr) {
+    const struct pinnacle_reg_write writes[] = {
+        {PINNACLE_REG_ERA_HIGH_BYTE, (uint8_t)(addr >> 8)},
+        {PINNACLE_REG_ERA_LOW_BYTE, (uint8_t)(addr & 0x00FF)},
+    };
+
+    int ret = pinnacle_write_seq(dev, writes, ARRAY_SIZE(writes));
+    if (ret < 0) {
+        LOG_ERR("Failed to write ERA address (%d)", ret);
+        return -EIO;
+    }
+
+    return 0;
+}
+
+static int pinnacle_era_wait(const struct device *dev) {
+    return pinnacle_wait_clear(dev, PINNACLE_REG_ERA_CONTROL, 0xFF);
+}
+
+/*
+ * Reads len consecutive ERA bytes, using auto-increment so the address is only written once.
+ * Callers run ERA access inside pinnacle_pass_begin()/pinnacle_pass_end().
+ */
+static int pinnacle_era_read(const struct device *dev, const uint16_t addr, uint8_t *buf,
+                             const size_t len) {
+    int ret = pinnacle_era_set_addr(dev, addr);
+    if (ret < 0) {
+        return ret;
+    }
+
+    for (size_t i = 0; i < len; i++) {
+        ret = pinnacle_write(dev, PINNACLE_REG_ERA_CONTROL,
+                             PINNACLE_ERA_CONTROL_READ | PINNACLE_ERA_CONTROL_AUTO_INC);
+        if (ret < 0) {
+            LOG_ERR("Failed to write ERA control (%d)", ret);
+            return -EIO;
+        }
+
+        ret = pinnacle_era_wait(dev);
+        if (ret < 0) {
+            return ret;
+        }
+
+        ret = pinnacle_seq_read(dev, PINNACLE_REG_ERA_VALUE, &buf[i], 1);
+        if (ret < 0) {
+            LOG_ERR("Failed to read ERA value (%d)", ret);
+            return -EIO;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Writes len consecutive ERA bytes, using auto-increment so the address is only written once.
+ * Callers run ERA access inside pinnacle_pass_begin()/pinnacle_pass_end().
+ */
+static int pinnacle_era_write(const struct device *dev, const uint16_t addr, const uint8_t *buf,
+                              const size_t len) {
+    int ret = pinnacle_era_set_addr(dev, addr);
+    if (ret < 0) {
+        return ret;
+    }
+
+    for (size_t i = 0; i < len; i++) {
+        const struct pinnacle_reg_write writes[] = {
+            {PINNACLE_REG_ERA_VALUE, buf[i]},
+            {PINNACLE_REG_ERA_CONTROL, PINNACLE_ERA_CONTROL_WRITE | PINNACLE_ERA_CONTROL_AUTO_INC},
+        };
+
+        ret = pinnacle_write_seq(dev, writes, ARRAY_SIZE(writes));
+        if (ret < 0) {
+            LOG_ERR("Failed to write ERA value (%d)", ret);
+            return -EIO;
+        }
+
+        ret = pinnacle_era_wait(dev);
+        if (ret < 0) {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
+// Emits the whole counts accumulated so far; the fractional remainder carries to the next flush
+static void pinnacle_flush_motion(const struct device *dev) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_data *data = dev->data;
+    // Division truncates toward zero, so the remainder keeps the sign of the accumulator
+    int32_t dx = data->acc_x / PINNACLE_SUBCOUNT_SCALE;
+    int32_t dy = data->acc_y / PINNACLE_SUBCOUNT_SCALE;
+    int32_t wheel = data->acc_wheel / config->scroll_divisor;
+
+    data->acc_x -= dx * PINNACLE_SUBCOUNT_SCALE;
+    data->acc_y -= dy * PINNACLE_SUBCOUNT_SCALE;
+    data->acc_wheel -= wheel * config->scroll_divisor;
+
+    if (dx == 0 && dy == 0 && wheel == 0) {
+        return;
+    }
+
+    if (dx != 0) {
+        input_report_rel(dev, INPUT_REL_X, dx, dy == 0 && wheel == 0, K_FOREVER);
+    }
+    if (dy != 0) {
+        input_report_rel(dev, INPUT_REL_Y, dy, wheel == 0, K_FOREVER);
+    }
+    if (wheel != 0) {
+        input_report_rel(dev, config->scroll_horizontal ? INPUT_REL_HWHEEL : INPUT_REL_WHEEL,
+                         wheel, true, K_FOREVER);
+    }
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_COALESCE)
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+    data->coalesce.reports++;
+    k_spin_unlock(&data->stats_lock, key);
+#endif
+}
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_COALESCE)
+
+static void pinnacle_flush_work_cb(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct pinnacle_data *data = CONTAINER_OF(dwork, struct pinnacle_data, flush_work);
+
+    pinnacle_flush_motion(data->dev);
+}
+
+int pinnacle_get_coalesce_stats(const struct device *dev, struct pinnacle_coalesce_stats *stats) {
+    struct pinnacle_data *data = dev->data;
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+    *stats = data->coalesce;
+    k_spin_unlock(&data->stats_lock, key);
+    return 0;
+}
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_COALESCE)
+
+// Takes pointer deltas in 1/PINNACLE_SUBCOUNT_SCALE count units and raw wheel counts
+static void pinnacle_queue_motion(const struct device *dev, int32_t dx, int32_t dy,
+                                  int32_t wheel) {
+    struct pinnacle_data *data = dev->data;
+
+    // Button-only and idle packets leave nothing to merge or flush
+    if (dx == 0 && dy == 0 && wheel == 0) {
+        return;
+    }
+
+    data->acc_x += dx;
+    data->acc_y += dy;
+    data->acc_wheel += wheel;
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_COALESCE)
+    // Replay flushes every packet, so its output doesn't depend on when the timer fires
+    if (atomic_test_bit(&data->flags, PINNACLE_FLAG_REPLAYING)) {
+        pinnacle_flush_motion(dev);
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+    data->coalesce.packets++;
+    k_spin_unlock(&data->stats_lock, key);
+    // No-op while a flush is already pending, which keeps the flush rate fixed
+    pinnacle_schedule_work(&data->flush_work, K_MSEC(CONFIG_INPUT_PINNACLE_COALESCE_INTERVAL_MS));
+#else
+    pinnacle_flush_motion(dev);
+#endif
+}
+
+static void pinnacle_report_buttons(const struct device *dev, uint8_t btn) {
+    struct pinnacle_data *data = dev->data;
+
+    if (!data->settings.no_taps && (btn || data->btn_cache)) {
+        uint8_t changed = btn ^ data->btn_cache;
+
+        if (changed) {
+            // Motion accumulated before the edge has to reach the host before it
+            pinnacle_flush_motion(dev);
+        }
+
+        for (int i = 0; i < 3; i++) {
+            if (changed & BIT(i)) {
+                changed &= ~BIT(i);
+                input_report_key(dev, INPUT_BTN_0 + i, (btn & BIT(i)) ? 1 : 0, changed == 0,
+                                 K_FOREVER);
+            }
+        }
+    }
+
+    data->btn_cache = btn;
+}
+
+static bool pinnacle_sample_rate_valid(uint8_t rate) {
+    static const uint8_t rates[] = {10, 20, 40, 60, 80, 100, 200};
+
+    for (size_t i = 0; i < ARRAY_SIZE(rates); i++) {
+        if (rates[i] == rate) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static int pinnacle_write_sample_rate(const struct device *dev, uint8_t rate) {
+    struct pinnacle_data *data = dev->data;
+
+    int ret = pinnacle_cached_write(dev, PINNACLE_SAMPLE, rate);
+    if (ret < 0) {
+        LOG_ERR("Failed to set sample rate %d", ret);
+        return ret;
+    }
+
+    LOG_DBG("Sample rate %d", rate);
+    data->cur_sample_rate = rate;
+    return 0;
+}
+
+// Drops to the idle rate after a run of motionless packets and back to full rate on motion
+static void pinnacle_adapt_sample_rate(const struct device *dev, bool motion) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_data *data = dev->data;
+
+    if (!config->idle_sample_rate) {
+        return;
+    }
+
+    if (motion) {
+        data->idle_packets = 0;
+        if (data->cur_sample_rate != data->sample_rate) {
+            pinnacle_write_sample_rate(dev, data->sample_rate);
+        }
+        return;
+    }
+
+    if (data->idle_packets < config->idle_sample_packets &&
+        ++data->idle_packets == config->idle_sample_packets) {
+        pinnacle_write_sample_rate(dev, config->idle_sample_rate);
+    }
+}
+
+/*
+ * Gain for a packet moving speed counts, in 1/PINNACLE_SUBCOUNT_SCALE units, interpolated between
+ * the <speed gain> points of the devicetree accel-curve. Flat outside the first and last point.
+ */
+static int32_t pinnacle_accel_gain(const struct pinnacle_config *config, int32_t speed) {
+    const uint16_t *curve = config->accel_curve;
+    const size_t len = config->accel_curve_len;
+
+    if (len < 2) {
+        return PINNACLE_SUBCOUNT_SCALE;
+    }
+
+    if (speed <= curve[0]) {
+        return curve[1];
+    }
+
+    for (size_t i = 2; i + 1 < len; i += 2) {
+        if (speed <= curve[i]) {
+            // speed > curve[i - 2] here, and speeds strictly increase (checked at build time),
+            // so the segment has a non-zero width
+            int32_t s0 = curve[i - 2], g0 = curve[i - 1];
+            int32_t s1 = curve[i], g1 = curve[i + 1];
+
+            return g0 + (g1 - g0) * (speed - s0) / (s1 - s0);
+        }
+    }
+
+    return curve[len - 1];
+}
+
+// Returns whether the packet carried any activity
+static bool pinnacle_process_rel_packet(const struct device *dev, const uint8_t *packet) {
+    const struct pinnacle_config *config = dev->config;
+
+    uint8_t btn = packet[0] &
+                  (PINNACLE_PACKET0_BTN_PRIM | PINNACLE_PACKET0_BTN_SEC | PINNACLE_PACKET0_BTN_AUX);
 
     int8_t dx = (int8_t)packet[1];
     int8_t dy = (int8_t)packet[2];
@@ -267,291 +1069,2038 @@ static void pinnacle_report_data(const struct device *dev) {
         WRITE_BIT(dy, 7, 1);
     }
 
-    if (data->in_int) {
-        LOG_DBG("Clearing status bit");
-        ret = pinnacle_clear_status(dev);
-        data->in_int = true;
+    // Intellimouse wheel count, widened first so inverting -128 doesn't wrap back to itself
+    int32_t wheel = (int8_t)packet[3];
+    if (config->scroll_invert) {
+        wheel = -wheel;
+    }
+
+    // Octagonal approximation of the vector length, max + min / 2, within ~12% of the real one
+    int32_t ax = ABS(dx), ay = ABS(dy);
+    int32_t gain = pinnacle_accel_gain(config, MAX(ax, ay) + MIN(ax, ay) / 2);
+
+    pinnacle_report_buttons(dev, btn);
+    pinnacle_queue_motion(dev, dx * gain, dy * gain, wheel);
+    return btn || dx || dy || wheel;
+}
+
+/*
+ * Absolute packets carry 12-bit X/Y and the Z (pressure) level. Z gates touch down and lift-off,
+ * so light touches below the threshold are rejected, and pointer deltas are computed here at
+ * full coordinate resolution instead of the clipped 8-bit relative ones.
+ */
+static bool pinnacle_process_abs_packet(const struct device *dev, const uint8_t *packet) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_data *data = dev->data;
+
+    uint8_t btn = packet[0] &
+                  (PINNACLE_PACKET0_BTN_PRIM | PINNACLE_PACKET0_BTN_SEC | PINNACLE_PACKET0_BTN_AUX);
+    uint16_t x = packet[2] | ((packet[4] & 0x0F) << 8);
+    uint16_t y = packet[3] | ((packet[4] & 0xF0) << 4);
+    uint8_t z = packet[5] & PINNACLE_ABS_Z_MASK;
+    bool touch = x != 0 && z >= config->abs_z_threshold;
+    int32_t dx = 0, dy = 0;
+
+    if (touch) {
+        x = CLAMP(x, PINNACLE_ABS_X_MIN, PINNACLE_ABS_X_MAX);
+        y = CLAMP(y, PINNACLE_ABS_Y_MIN, PINNACLE_ABS_Y_MAX);
+        if (data->abs_touch) {
+            dx = x - data->abs_x;
+            dy = y - data->abs_y;
+        }
+        data->abs_x = x;
+        data->abs_y = y;
+    }
+
+    if (touch != data->abs_touch) {
+        LOG_DBG("%s (z %d)", touch ? "Touch down" : "Lift off", z);
+        data->abs_touch = touch;
+        if (config->report_absolute) {
+            input_report_key(dev, INPUT_BTN_TOUCH, touch, !touch, K_FOREVER);
+        }
+    }
+
+    if (config->report_absolute && touch) {
+        input_report_abs(dev, INPUT_ABS_X, x, false, K_FOREVER);
+        input_report_abs(dev, INPUT_ABS_Y, y, true, K_FOREVER);
+    }
+
+    // Motion a gesture consumes still counts as activity
+    bool active = btn || dx || dy;
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_GESTURES)
+    if (pinnacle_gesture_process(dev, touch, x, y, dx, dy)) {
+        dx = 0;
+        dy = 0;
+    }
+#endif
+
+    int32_t ax = ABS(dx), ay = ABS(dy);
+    int32_t gain = pinnacle_accel_gain(config, (MAX(ax, ay) + MIN(ax, ay) / 2) /
+                                                   config->abs_delta_divisor);
+
+    pinnacle_report_buttons(dev, btn);
+    pinnacle_queue_motion(dev, dx * gain / config->abs_delta_divisor,
+                          dy * gain / config->abs_delta_divisor, 0);
+    return active;
+}
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ADAPTIVE_SLEEP)
+
+static int pinnacle_write_sleep_interval(const struct device *dev, uint8_t interval) {
+    struct pinnacle_data *data = dev->data;
+
+    int ret = pinnacle_cached_write(dev, PINNACLE_SLEEP_INTERVAL, interval);
+    if (ret < 0) {
+        LOG_ERR("Failed to set sleep interval %d", ret);
+        return ret;
+    }
+
+    LOG_DBG("Sleep interval %d", interval);
+    data->sleep_interval = interval;
+    return 0;
+}
+
+// Doubles the sleep interval for every step of idle time, up to the devicetree sleep-interval
+static void pinnacle_sleep_work_cb(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct pinnacle_data *data = CONTAINER_OF(dwork, struct pinnacle_data, sleep_work);
+    const struct device *dev = data->dev;
+    const struct pinnacle_config *config = dev->config;
+    uint32_t idle_ms = k_uptime_get_32() - data->sleep_active_ms;
+
+    if (idle_ms < CONFIG_INPUT_PINNACLE_ADAPTIVE_SLEEP_STEP_MS) {
+        // Activity since this was scheduled, so wait out the rest of the step
+        pinnacle_schedule_work(dwork,
+                               K_MSEC(CONFIG_INPUT_PINNACLE_ADAPTIVE_SLEEP_STEP_MS - idle_ms));
+        return;
+    }
+
+    uint8_t next = MIN(MAX(data->sleep_interval, 1) * 2, config->sleep_interval);
+    if (pinnacle_write_sleep_interval(dev, next) < 0 || next == config->sleep_interval) {
+        return;
+    }
+
+    pinnacle_schedule_work(dwork, K_MSEC(CONFIG_INPUT_PINNACLE_ADAPTIVE_SLEEP_STEP_MS));
+}
+
+/*
+ * Called for every packet. Only a timestamp in the common case: the interval is written once
+ * per burst of activity and the step work, if already pending, is left alone.
+ */
+static void pinnacle_adapt_sleep_interval(const struct device *dev) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_data *data = dev->data;
+
+    if (!config->sleep_interval_active) {
+        return;
+    }
+
+    data->sleep_active_ms = k_uptime_get_32();
+    if (data->sleep_interval != config->sleep_interval_active) {
+        pinnacle_write_sleep_interval(dev, config->sleep_interval_active);
+    }
+
+    pinnacle_schedule_work(&data->sleep_work, K_MSEC(CONFIG_INPUT_PINNACLE_ADAPTIVE_SLEEP_STEP_MS));
+}
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_ADAPTIVE_SLEEP)
+
+#if IS_ENABLED(CONFIG_PM_DEVICE)
+
+static void pinnacle_track_resume(struct pinnacle_data *data) {
+    uint32_t resume_us = k_cyc_to_us_floor32(k_cycle_get_32() - data->resume_cycles);
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+    data->pm.last_resume_us = resume_us;
+    data->pm.max_resume_us = MAX(data->pm.max_resume_us, resume_us);
+    data->pm.resumes++;
+    k_spin_unlock(&data->stats_lock, key);
+
+    LOG_DBG("Resume to first packet: %u us", resume_us);
+}
+
+int pinnacle_get_pm_stats(const struct device *dev, struct pinnacle_pm_stats *stats) {
+    struct pinnacle_data *data = dev->data;
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+    *stats = data->pm;
+    k_spin_unlock(&data->stats_lock, key);
+    return 0;
+}
+
+#endif // IS_ENABLED(CONFIG_PM_DEVICE)
+
+// Turns one packet into input events, shared by live data and trace replay; true on activity
+static bool pinnacle_decode_packet(const struct device *dev, const uint8_t *packet) {
+    const struct pinnacle_config *config = dev->config;
+
+    if (config->absolute) {
+        return pinnacle_process_abs_packet(dev, packet);
+    }
+
+    return pinnacle_process_rel_packet(dev, packet);
+}
+
+static void pinnacle_process_packet(const struct device *dev, const uint8_t *packet) {
+    const struct pinnacle_config *config = dev->config;
+
+    LOG_HEXDUMP_DBG(packet, config->packet_len, "Pinnacle Packets");
+
+    struct pinnacle_data *data = dev->data;
+
+    data->packets++;
+
+#if IS_ENABLED(CONFIG_PM_DEVICE)
+
+    if (atomic_test_and_clear_bit(&data->flags, PINNACLE_FLAG_RESUMED)) {
+        pinnacle_track_resume(data);
+    }
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ADAPTIVE_SLEEP)
+    pinnacle_adapt_sleep_interval(dev);
+#endif
+
+    bool active = pinnacle_decode_packet(dev, packet);
+
+    pinnacle_stats_report(dev);
+    pinnacle_adapt_sample_rate(dev, active);
+}
+
+// Returns whether a packet was read and processed
+static bool pinnacle_report_data(const struct device *dev) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_data *data = dev->data;
+    // Buffer mirrors the register file starting at STATUS1, so a burst read lands the packet at
+    // the same offset as the separate packet read does.
+    uint8_t regs[PINNACLE_BURST_MAX_LEN];
+    uint8_t *packet = &regs[PINNACLE_2_2_PACKET0 - PINNACLE_STATUS1];
+    int ret;
+    ret = pinnacle_seq_read(dev, PINNACLE_STATUS1, regs,
+                            config->burst_read ? PINNACLE_BURST_LEN(config->packet_len) : 1);
+    if (ret < 0) {
+        LOG_ERR("read status: %d", ret);
+        return false;
+    }
+
+    LOG_HEXDUMP_DBG(regs, 1, "Pinnacle Status1");
+
+    // Ignore 0xFF packets that indicate communcation failure, or if SW_DR isn't asserted
+    if (regs[0] == 0xFF) {
+        PINNACLE_STATS_INC(dev, comm_failures);
+        pinnacle_trace_capture(dev, regs[0], NULL);
+        // The chip may have browned out and reset, so stop trusting the shadow
+        pinnacle_shadow_invalidate(dev);
+        return false;
+    }
+    if (!(regs[0] & PINNACLE_STATUS1_SW_DR)) {
+        PINNACLE_STATS_INC(dev, spurious);
+        pinnacle_trace_capture(dev, regs[0], NULL);
+        return false;
+    }
+
+    if (!config->burst_read) {
+        ret = pinnacle_seq_read(dev, PINNACLE_2_2_PACKET0, packet, config->packet_len);
+        if (ret < 0) {
+            LOG_ERR("read packet: %d", ret);
+            return false;
+        }
+    }
+
+    pinnacle_trace_capture(dev, regs[0], packet);
+
+    if (data->in_int) {
+        LOG_DBG("Clearing status bit");
+        ret = pinnacle_clear_status(dev);
+        data->in_int = true;
+    }
+
+    pinnacle_process_packet(dev, packet);
+    return true;
+}
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_TRACE)
+
+// Capture index of the oldest entry still in the ring, up to the head snapshot taken here
+static uint32_t pinnacle_trace_first_locked(struct pinnacle_data *data, uint32_t *head) {
+    *head = data->trace_head;
+    return *head - MIN(*head, CONFIG_INPUT_PINNACLE_TRACE_LEN);
+}
+
+static uint32_t pinnacle_trace_first(struct pinnacle_data *data, uint32_t *head) {
+    k_spinlock_key_t key = k_spin_lock(&data->trace_lock);
+    uint32_t first = pinnacle_trace_first_locked(data, head);
+
+    k_spin_unlock(&data->trace_lock, key);
+    return first;
+}
+
+// Copies the entry at capture index i without racing a capture into the same slot
+static void pinnacle_trace_get(struct pinnacle_data *data, uint32_t i,
+                               struct pinnacle_trace_entry *entry) {
+    k_spinlock_key_t key = k_spin_lock(&data->trace_lock);
+
+    *entry = data->trace[i & PINNACLE_TRACE_MASK];
+    k_spin_unlock(&data->trace_lock, key);
+}
+
+size_t pinnacle_trace_read(const struct device *dev, struct pinnacle_trace_entry *out,
+                           size_t max) {
+    struct pinnacle_data *data = dev->data;
+    k_spinlock_key_t key = k_spin_lock(&data->trace_lock);
+    uint32_t head;
+    uint32_t first = pinnacle_trace_first_locked(data, &head);
+    size_t n = MIN(head - first, max);
+
+    for (size_t i = 0; i < n; i++) {
+        out[i] = data->trace[(head - n + i) & PINNACLE_TRACE_MASK];
+    }
+
+    k_spin_unlock(&data->trace_lock, key);
+    return n;
+}
+
+void pinnacle_trace_clear(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+    k_spinlock_key_t key = k_spin_lock(&data->trace_lock);
+
+    data->trace_head = 0;
+    k_spin_unlock(&data->trace_lock, key);
+}
+
+void pinnacle_trace_encode(const struct pinnacle_trace_entry *entry, uint8_t *record) {
+    sys_put_le32(entry->time_us, record);
+    record[4] = entry->seq;
+    record[5] = entry->status;
+    memcpy(&record[6], entry->packet, sizeof(entry->packet));
+}
+
+void pinnacle_trace_decode(const uint8_t *record, struct pinnacle_trace_entry *entry) {
+    entry->time_us = sys_get_le32(record);
+    entry->seq = record[4];
+    entry->status = record[5];
+    memcpy(entry->packet, &record[6], sizeof(entry->packet));
+}
+
+void pinnacle_trace_log(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+    struct pinnacle_trace_entry entry;
+    uint8_t record[PINNACLE_TRACE_RECORD_LEN];
+    uint32_t head;
+
+    for (uint32_t i = pinnacle_trace_first(data, &head); i != head; i++) {
+        pinnacle_trace_get(data, i, &entry);
+        pinnacle_trace_encode(&entry, record);
+        LOG_HEXDUMP_INF(record, sizeof(record), dev->name);
+    }
+}
+
+struct pinnacle_replay_args {
+    const struct pinnacle_trace_entry *entries;
+    size_t count;
+    bool reset;
+};
+
+// On the work queue, so replayed packets never interleave with live ones in the decode state
+static int pinnacle_trace_replay_sync(const struct device *dev, const void *arg) {
+    const struct pinnacle_replay_args *args = arg;
+    struct pinnacle_data *data = dev->data;
+    int processed = 0;
+
+    if (args->reset) {
+        // Start from a released pad, so the output depends on the entries alone
+        data->btn_cache = 0;
+        data->acc_x = 0;
+        data->acc_y = 0;
+        data->acc_wheel = 0;
+        data->abs_x = 0;
+        data->abs_y = 0;
+        data->abs_touch = false;
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_GESTURES)
+        memset(&data->gesture, 0, sizeof(data->gesture));
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_COALESCE)
+        k_work_cancel_delayable(&data->flush_work);
+#endif
+    }
+
+    atomic_set_bit(&data->flags, PINNACLE_FLAG_REPLAYING);
+    for (size_t i = 0; i < args->count; i++) {
+        uint8_t status = args->entries[i].status;
+
+        if (status == 0xFF || !(status & PINNACLE_STATUS1_SW_DR)) {
+            continue;
+        }
+
+        // Decode only: packet counters, adaptive rates and the stats histograms stay live-only
+        pinnacle_decode_packet(dev, args->entries[i].packet);
+        processed++;
+    }
+    atomic_clear_bit(&data->flags, PINNACLE_FLAG_REPLAYING);
+
+    return processed;
+}
+
+static int pinnacle_trace_replay_run(const struct device *dev,
+                                     const struct pinnacle_replay_args *args) {
+    struct pinnacle_data *data = dev->data;
+
+    // Nothing feeds the decode state while suspended, and run_sync refuses, so run right here
+    if (atomic_test_bit(&data->flags, PINNACLE_FLAG_SUSPENDED)) {
+        return pinnacle_trace_replay_sync(dev, args);
+    }
+
+    return pinnacle_run_sync(dev, pinnacle_trace_replay_sync, args);
+}
+
+int pinnacle_trace_replay_continue(const struct device *dev,
+                                   const struct pinnacle_trace_entry *entries, size_t count) {
+    struct pinnacle_replay_args args = {.entries = entries, .count = count, .reset = false};
+
+    return pinnacle_trace_replay_run(dev, &args);
+}
+
+int pinnacle_trace_replay(const struct device *dev, const struct pinnacle_trace_entry *entries,
+                          size_t count) {
+    struct pinnacle_replay_args args = {.entries = entries, .count = count, .reset = true};
+
+    return pinnacle_trace_replay_run(dev, &args);
+}
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_TRACE)
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_LATENCY_TRACKING)
+
+// Only runs that a fresh DR edge or poll tick started count; resubmits would reuse a stale stamp
+static void pinnacle_track_latency(struct pinnacle_data *data) {
+    if (!atomic_test_and_clear_bit(&data->flags, PINNACLE_FLAG_DR_STAMPED)) {
+        return;
+    }
+
+    uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - data->dr_cycles);
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+    data->latency.last_us = latency_us;
+    data->latency.max_us = MAX(data->latency.max_us, latency_us);
+    data->latency.total_us += latency_us;
+    data->latency.count++;
+    k_spin_unlock(&data->stats_lock, key);
+
+    LOG_DBG("DR to work start: %u us", latency_us);
+}
+
+int pinnacle_get_latency_stats(const struct device *dev, struct pinnacle_latency_stats *stats,
+                               bool reset) {
+    struct pinnacle_data *data = dev->data;
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+    // Snapshot and reset together, so no sample lands in between and gets lost
+    *stats = data->latency;
+    if (reset) {
+        memset(&data->latency, 0, sizeof(data->latency));
+    }
+
+    k_spin_unlock(&data->stats_lock, key);
+    return 0;
+}
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_LATENCY_TRACKING)
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+
+static void pinnacle_async_start(const struct device *dev);
+
+static void pinnacle_async_finish(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+
+    data->async_state = PINNACLE_ASYNC_IDLE;
+    atomic_clear_bit(&data->async_flags, PINNACLE_ASYNC_BUSY);
+
+    // A DR edge that arrived mid-chain is serviced now instead of being dropped
+    if (atomic_test_and_clear_bit(&data->async_flags, PINNACLE_ASYNC_PENDING) &&
+        !atomic_test_bit(&data->flags, PINNACLE_FLAG_SUSPENDED)) {
+        pinnacle_async_start(dev);
+    }
+}
+
+static int pinnacle_async_read(const struct device *dev, const uint8_t addr, const uint8_t len) {
+    const pinnacle_async_read_t op = PINNACLE_BUS_ASYNC_OP(dev, async_read);
+
+    if (!op) {
+        return -ENOTSUP;
+    }
+
+    return op(dev, addr, len);
+}
+
+static int pinnacle_async_write(const struct device *dev, const uint8_t addr, const uint8_t val) {
+    const pinnacle_write_t op = PINNACLE_BUS_ASYNC_OP(dev, async_write);
+
+    if (!op) {
+        return -ENOTSUP;
+    }
+
+    return op(dev, addr, val);
+}
+
+/*
+ * Bus completion callback, possibly in ISR context and with the bus still locked: starting the
+ * next transfer here would assert or deadlock, so only the result is handed to the chain work.
+ */
+static void pinnacle_async_cb(const struct device *bus, int result, void *user_data) {
+    const struct device *dev = user_data;
+    struct pinnacle_data *data = dev->data;
+
+    data->async_result = result;
+    pinnacle_submit_work(&data->async_work);
+}
+
+// Starts the first transfer of a chain, or hands over to the blocking path if the bus can't
+static void pinnacle_async_begin(const struct device *dev) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_data *data = dev->data;
+
+    data->async_state = PINNACLE_ASYNC_READ_STATUS;
+    int ret = pinnacle_async_read(dev, PINNACLE_STATUS1,
+                                  config->burst_read ? PINNACLE_BURST_LEN(config->packet_len) : 1);
+    if (ret < 0) {
+        LOG_DBG("async read unavailable (%d), using blocking fetch", ret);
+        data->async_state = PINNACLE_ASYNC_IDLE;
+        atomic_set_bit(&data->async_flags, PINNACLE_ASYNC_FALLBACK);
+        atomic_clear_bit(&data->async_flags, PINNACLE_ASYNC_BUSY);
+        pinnacle_submit_work(&data->work);
+    }
+}
+
+// Runs one step of the chain per transfer completion, always from the work queue thread
+static void pinnacle_async_work_cb(struct k_work *work) {
+    struct pinnacle_data *data = CONTAINER_OF(work, struct pinnacle_data, async_work);
+    const struct device *dev = data->dev;
+    const struct pinnacle_config *config = dev->config;
+    uint8_t *regs = data->async_bufs.regs;
+    int ret;
+
+    // PM suspend waits for the chain to go idle: the transfer in flight ends it, nothing follows
+    if (atomic_test_bit(&data->flags, PINNACLE_FLAG_SUSPENDED)) {
+        pinnacle_async_finish(dev);
+        return;
+    }
+
+    if (data->async_state == PINNACLE_ASYNC_IDLE) {
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_LATENCY_TRACKING)
+        pinnacle_track_latency(data);
+#endif
+        pinnacle_async_begin(dev);
+        return;
+    }
+
+    if (data->async_result < 0) {
+        LOG_ERR("async transfer failed in state %d: %d", data->async_state, data->async_result);
+        PINNACLE_STATS_INC(dev, bus_errors);
+        pinnacle_async_finish(dev);
+        return;
+    }
+
+    switch (data->async_state) {
+    case PINNACLE_ASYNC_READ_STATUS:
+        // Ignore 0xFF packets that indicate communcation failure, or if SW_DR isn't asserted
+        if (regs[0] == 0xFF || !(regs[0] & PINNACLE_STATUS1_SW_DR)) {
+            pinnacle_trace_capture(dev, regs[0], NULL);
+            if (regs[0] == 0xFF) {
+                PINNACLE_STATS_INC(dev, comm_failures);
+                pinnacle_shadow_invalidate(dev);
+            } else {
+                PINNACLE_STATS_INC(dev, spurious);
+            }
+            pinnacle_async_finish(dev);
+            return;
+        }
+
+        if (!config->burst_read) {
+            data->async_state = PINNACLE_ASYNC_READ_PACKET;
+            ret = pinnacle_async_read(dev, PINNACLE_2_2_PACKET0, config->packet_len);
+            break;
+        }
+
+        data->async_state = PINNACLE_ASYNC_CLEAR_STATUS;
+        ret = pinnacle_async_write(dev, PINNACLE_STATUS1, 0);
+        break;
+    case PINNACLE_ASYNC_READ_PACKET:
+        data->async_state = PINNACLE_ASYNC_CLEAR_STATUS;
+        ret = pinnacle_async_write(dev, PINNACLE_STATUS1, 0);
+        break;
+    case PINNACLE_ASYNC_CLEAR_STATUS:
+        pinnacle_trace_capture(dev, regs[0], &regs[PINNACLE_2_2_PACKET0 - PINNACLE_STATUS1]);
+        ret = k_msgq_put(&data->async_msgq, &regs[PINNACLE_2_2_PACKET0 - PINNACLE_STATUS1],
+                         K_NO_WAIT);
+        if (ret < 0) {
+            LOG_WRN("Dropping packet, report queue full");
+        }
+        pinnacle_submit_work(&data->work);
+        pinnacle_async_finish(dev);
+        return;
+    default:
+        pinnacle_async_finish(dev);
+        return;
+    }
+
+    if (ret < 0) {
+        LOG_ERR("Failed to chain async transfer in state %d: %d", data->async_state, ret);
+        pinnacle_async_finish(dev);
+    }
+}
+
+// Safe from ISR context: only claims the chain and queues its first step
+static void pinnacle_async_start(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+
+    if (atomic_test_and_set_bit(&data->async_flags, PINNACLE_ASYNC_BUSY)) {
+        atomic_set_bit(&data->async_flags, PINNACLE_ASYNC_PENDING);
+        return;
+    }
+
+    pinnacle_submit_work(&data->async_work);
+}
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_LATENCY_TRACKING) || IS_ENABLED(CONFIG_INPUT_PINNACLE_STATS)
+// One flag per consumer, so latency tracking and the report histogram each sample an edge once
+static void pinnacle_stamp_dr(struct pinnacle_data *data) {
+    data->dr_cycles = k_cycle_get_32();
+    atomic_or(&data->flags, BIT(PINNACLE_FLAG_DR_STAMPED) | BIT(PINNACLE_FLAG_REPORT_STAMPED));
+}
+#endif
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_POLL)
+
+static void pinnacle_poll_set_rate(const struct device *dev, bool slow) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_data *data = dev->data;
+    k_timeout_t period = K_MSEC(slow ? config->poll_idle_interval_ms : config->poll_interval_ms);
+
+    LOG_DBG("Polling at the %s rate", slow ? "idle" : "full");
+    data->poll_slow = slow;
+    k_timer_start(&data->poll_timer, period, period);
+}
+
+static void pinnacle_poll_enable(const struct device *dev, bool en) {
+    struct pinnacle_data *data = dev->data;
+
+    if (!en) {
+        atomic_clear_bit(&data->flags, PINNACLE_FLAG_POLLING);
+        k_timer_stop(&data->poll_timer);
+        return;
+    }
+
+    atomic_set_bit(&data->flags, PINNACLE_FLAG_POLLING);
+    data->poll_active_ms = k_uptime_get_32();
+    pinnacle_poll_set_rate(dev, false);
+}
+
+// Stands in for the DR interrupt, so the poll runs the same STATUS1 and packet read path
+static void pinnacle_poll_timer_cb(struct k_timer *timer) {
+    struct pinnacle_data *data = CONTAINER_OF(timer, struct pinnacle_data, poll_timer);
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_LATENCY_TRACKING) || IS_ENABLED(CONFIG_INPUT_PINNACLE_STATS)
+    pinnacle_stamp_dr(data);
+#endif
+    data->in_int = true;
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+    pinnacle_async_start(data->dev);
+#else
+    pinnacle_submit_work(&data->work);
+#endif
+}
+
+// Full rate while packets keep coming, idle rate once none came for poll-idle-after-ms
+static void pinnacle_poll_adapt(const struct device *dev) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_data *data = dev->data;
+    uint32_t now = k_uptime_get_32();
+
+    if (config->dr.port || !atomic_test_bit(&data->flags, PINNACLE_FLAG_POLLING)) {
+        return;
+    }
+
+    if (data->packets != data->poll_packets) {
+        data->poll_packets = data->packets;
+        data->poll_active_ms = now;
+        if (data->poll_slow) {
+            pinnacle_poll_set_rate(dev, false);
+        }
+    } else if (!data->poll_slow && now - data->poll_active_ms >= config->poll_idle_after_ms) {
+        pinnacle_poll_set_rate(dev, true);
+    }
+}
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_POLL)
+
+int pinnacle_get_dr_stats(const struct device *dev, struct pinnacle_dr_stats *stats) {
+    struct pinnacle_data *data = dev->data;
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+    *stats = data->dr_stats;
+    k_spin_unlock(&data->stats_lock, key);
+    return 0;
+}
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_DR_WATCHDOG)
+
+// Armed whenever a work pass ends with DR still asserted; a no-op while already armed
+static void pinnacle_dr_watchdog_arm(const struct device *dev) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_data *data = dev->data;
+
+    if (!pinnacle_dr_asserted(config) || k_work_delayable_is_pending(&data->dr_watchdog)) {
+        return;
+    }
+
+    data->watchdog_packets = data->packets;
+    pinnacle_schedule_work(&data->dr_watchdog, K_MSEC(CONFIG_INPUT_PINNACLE_DR_WATCHDOG_MS));
+}
+
+// DR held asserted with no packet processed since arming: the edge was lost, so resync
+static void pinnacle_dr_watchdog_cb(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct pinnacle_data *data = CONTAINER_OF(dwork, struct pinnacle_data, dr_watchdog);
+    const struct device *dev = data->dev;
+    const struct pinnacle_config *config = dev->config;
+
+    if (atomic_test_bit(&data->flags, PINNACLE_FLAG_SUSPENDED) || !pinnacle_dr_asserted(config) ||
+        data->packets != data->watchdog_packets) {
+        return;
+    }
+
+    LOG_WRN("DR stuck without new packets, resynchronizing");
+    k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+    data->dr_stats.recoveries++;
+    k_spin_unlock(&data->stats_lock, key);
+
+    // The packet holding DR is read first; reading it is also what clears its status
+    data->in_int = true;
+    if (!pinnacle_report_data(dev)) {
+        // Nothing to read, so whatever holds DR up is just dropped
+        pinnacle_clear_status(dev);
+    }
+    pinnacle_shadow_load(dev);
+
+    // Packets queued behind it have no edge of their own either
+    if (pinnacle_dr_asserted(config)) {
+        data->in_int = true;
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+        atomic_set_bit(&data->async_flags, PINNACLE_ASYNC_FALLBACK);
+#endif
+        pinnacle_submit_work(&data->work);
+    }
+}
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_DR_WATCHDOG)
+
+static void pinnacle_work_cb(struct k_work *work) {
+    struct pinnacle_data *data = CONTAINER_OF(work, struct pinnacle_data, work);
+
+    // Submitted before PM suspend disabled the interrupt; the chip is shut down by now
+    if (atomic_test_bit(&data->flags, PINNACLE_FLAG_SUSPENDED)) {
+        return;
+    }
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_LATENCY_TRACKING)
+    pinnacle_track_latency(data);
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+    uint8_t packet[PINNACLE_PACKET_MAX_LEN];
+
+    if (atomic_test_and_clear_bit(&data->async_flags, PINNACLE_ASYNC_FALLBACK)) {
+        pinnacle_report_data(data->dev);
+    }
+
+    while (k_msgq_get(&data->async_msgq, packet, K_NO_WAIT) == 0) {
+        pinnacle_process_packet(data->dev, packet);
+    }
+#else
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_DRAIN)
+    const struct pinnacle_config *config = data->dev->config;
+    bool read = pinnacle_report_data(data->dev);
+
+    /*
+     * A packet that raised DR while the status clear was in flight produced no edge of its own.
+     * DR may also not have dropped yet right after the clear, so a read that finds no SW_DR
+     * ends the loop and isn't counted.
+     */
+    for (int i = 1; read && i < CONFIG_INPUT_PINNACLE_DRAIN_BUDGET && pinnacle_dr_asserted(config);
+         i++) {
+        read = pinnacle_report_data(data->dev);
+        if (read) {
+            k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+            data->dr_stats.drained++;
+            k_spin_unlock(&data->stats_lock, key);
+        }
+    }
+#else
+    pinnacle_report_data(data->dev);
+#endif
+#endif
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_DR_WATCHDOG)
+    pinnacle_dr_watchdog_arm(data->dev);
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_POLL)
+    pinnacle_poll_adapt(data->dev);
+#endif
+}
+
+static void pinnacle_gpio_cb(const struct device *port, struct gpio_callback *cb, uint32_t pins) {
+    struct pinnacle_data *data = CONTAINER_OF(cb, struct pinnacle_data, gpio_cb);
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_WAIT_ON_DR)
+    // During a pass the edge only wakes the waiter; pinnacle_pass_end() picks up any SW_DR
+    if (atomic_test_bit(&data->flags, PINNACLE_FLAG_WAITING)) {
+        k_sem_give(&data->cc_sem);
+        return;
+    }
+#endif
+
+    LOG_DBG("HW DR asserted");
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_LATENCY_TRACKING) || IS_ENABLED(CONFIG_INPUT_PINNACLE_STATS)
+    pinnacle_stamp_dr(data);
+#endif
+    PINNACLE_STATS_INC(data->dev, interrupts);
+    data->in_int = true;
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+    pinnacle_async_start(data->dev);
+#else
+    pinnacle_submit_work(&data->work);
+#endif
+}
+
+static int pinnacle_adc_sensitivity_reg_value(enum pinnacle_sensitivity sensitivity) {
+    switch (sensitivity) {
+    case PINNACLE_SENSITIVITY_1X:
+        return PINNACLE_TRACKING_ADC_CONFIG_1X;
+    case PINNACLE_SENSITIVITY_2X:
+        return PINNACLE_TRACKING_ADC_CONFIG_2X;
+    case PINNACLE_SENSITIVITY_3X:
+        return PINNACLE_TRACKING_ADC_CONFIG_3X;
+    case PINNACLE_SENSITIVITY_4X:
+        return PINNACLE_TRACKING_ADC_CONFIG_4X;
+    default:
+        return PINNACLE_TRACKING_ADC_CONFIG_1X;
+    }
+}
+
+static int pinnacle_set_adc_tracking_sensitivity(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+    struct pinnacle_shadow *shadow = &data->shadow;
+    uint8_t val;
+    int ret = 0;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    // The low bits are factory tuning, so they are read once and kept in the shadow
+    if (!atomic_test_bit(&shadow->valid, PINNACLE_SHADOW_ADC_BIT)) {
+        ret = pinnacle_era_read(dev, PINNACLE_ERA_REG_TRACKING_ADC_CONFIG, &shadow->adc_config, 1);
+        if (ret < 0) {
+            LOG_ERR("Failed to get ADC sensitivity %d", ret);
+            goto out;
+        }
+        atomic_set_bit(&shadow->valid, PINNACLE_SHADOW_ADC_BIT);
+    }
+
+    val = (shadow->adc_config & 0x3F) |
+          pinnacle_adc_sensitivity_reg_value(data->settings.sensitivity);
+    if (val == shadow->adc_config) {
+        shadow->stats.avoided++;
+        goto out;
+    }
+
+    ret = pinnacle_era_write(dev, PINNACLE_ERA_REG_TRACKING_ADC_CONFIG, &val, 1);
+    if (ret < 0) {
+        LOG_ERR("Failed to set ADC sensitivity %d", ret);
+        atomic_clear_bit(&shadow->valid, PINNACLE_SHADOW_ADC_BIT);
+        goto out;
+    }
+
+    shadow->adc_config = val;
+
+out:
+    k_mutex_unlock(&data->lock);
+    return ret;
+}
+
+// Applies the devicetree ERA write table, merging runs of consecutive addresses
+static int pinnacle_era_apply_table(const struct device *dev) {
+    const struct pinnacle_config *config = dev->config;
+    uint8_t run[PINNACLE_ERA_RUN_MAX];
+    int ret = 0;
+
+    for (size_t i = 0; i + 1 < config->era_init_len;) {
+        uint16_t start = config->era_init[i];
+        size_t n = 0;
+
+        while (i + 1 < config->era_init_len && n < ARRAY_SIZE(run) &&
+               config->era_init[i] == start + n) {
+            run[n++] = (uint8_t)config->era_init[i + 1];
+            i += 2;
+        }
+
+        ret = pinnacle_era_write(dev, start, run, n);
+        if (ret < 0) {
+            LOG_ERR("Failed to write ERA 0x%04x (+%zu) %d", start, n, ret);
+            return ret;
+        }
+    }
+
+    return ret;
+}
+
+static int pinnacle_write_z_min(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+
+    int ret = pinnacle_era_write(dev, PINNACLE_ERA_REG_X_AXIS_WIDE_Z_MIN,
+                                 &data->settings.x_axis_z_min, 1);
+    if (ret < 0) {
+        LOG_ERR("Failed to set X-Axis Min-Z %d", ret);
+        return ret;
+    }
+
+    ret = pinnacle_era_write(dev, PINNACLE_ERA_REG_Y_AXIS_WIDE_Z_MIN,
+                             &data->settings.y_axis_z_min, 1);
+    if (ret < 0) {
+        LOG_ERR("Failed to set Y-Axis Min-Z %d", ret);
+    }
+
+    return ret;
+}
+
+// All ERA tuning done in a single pass
+static int pinnacle_era_init(const struct device *dev) {
+    int ret, end;
+
+    pinnacle_pass_begin(dev);
+
+    ret = pinnacle_set_adc_tracking_sensitivity(dev);
+    if (ret < 0) {
+        LOG_ERR("Failed to set ADC sensitivity %d", ret);
+        goto out;
+    }
+
+    ret = pinnacle_write_z_min(dev);
+    if (ret < 0) {
+        goto out;
+    }
+
+    ret = pinnacle_era_apply_table(dev);
+    if (ret < 0) {
+        LOG_ERR("Failed to apply ERA table %d", ret);
+    }
+
+out:
+    end = pinnacle_pass_end(dev);
+    return ret < 0 ? ret : end;
+}
+
+static int pinnacle_force_recalibrate(const struct device *dev) {
+    uint8_t val;
+    int ret, end;
+
+    pinnacle_pass_begin(dev);
+
+    ret = pinnacle_seq_read(dev, PINNACLE_CAL_CFG, &val, 1);
+    if (ret < 0) {
+        LOG_ERR("Failed to get cal config %d", ret);
+        goto out;
+    }
+
+    val |= 0x01;
+    ret = pinnacle_write(dev, PINNACLE_CAL_CFG, val);
+    if (ret < 0) {
+        LOG_ERR("Failed to force calibration %d", ret);
+        goto out;
+    }
+
+    ret = pinnacle_wait_clear(dev, PINNACLE_CAL_CFG, 0x01);
+    if (ret < 0) {
+        LOG_ERR("Calibration did not complete %d", ret);
+    }
+
+out:
+    end = pinnacle_pass_end(dev);
+    return ret < 0 ? ret : end;
+}
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_CAL_CACHE)
+
+struct pinnacle_cal_load {
+    struct pinnacle_cal_blob *blob;
+    bool found;
+};
+
+static uint32_t pinnacle_cal_crc(const struct pinnacle_cal_blob *blob) {
+    return crc32_ieee((const uint8_t *)blob, offsetof(struct pinnacle_cal_blob, crc));
+}
+
+static void pinnacle_cal_key(const struct device *dev, char *key, size_t len) {
+    snprintf(key, len, PINNACLE_CAL_SETTINGS_ROOT "/%s", dev->name);
+}
+
+static int pinnacle_cal_load_cb(const char *key, size_t len, settings_read_cb read_cb,
+                                void *cb_arg, void *param) {
+    struct pinnacle_cal_load *load = param;
+
+    if (len != sizeof(*load->blob)) {
+        LOG_WRN("Ignoring saved calibration with size %zu", len);
+        return 0;
+    }
+
+    int ret = read_cb(cb_arg, load->blob, sizeof(*load->blob));
+    if (ret < 0) {
+        return ret;
+    }
+
+    load->found = true;
+    return 0;
+}
+
+/*
+ * Restores saved compensation data in one bulk ERA write and reads it back to check it landed;
+ * any mismatch means recalibrating.
+ */
+static int pinnacle_cal_restore(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+    struct pinnacle_cal_blob blob;
+    struct pinnacle_cal_load load = {.blob = &blob};
+    uint8_t check[sizeof(blob.comp)];
+    char key[64];
+
+    if (data->fw_id[0] == 0) {
+        return -ENODEV;
+    }
+
+    pinnacle_cal_key(dev, key, sizeof(key));
+
+    // Deferred bring-up can run before the application loads settings, so read the key directly.
+    // This needs the settings subsystem already initialized, which is up to the application.
+    int ret = settings_load_subtree_direct(key, pinnacle_cal_load_cb, &load);
+    if (ret < 0 || !load.found) {
+        LOG_DBG("No saved calibration");
+        return -ENOENT;
+    }
+
+    if (blob.crc != pinnacle_cal_crc(&blob) || memcmp(blob.fw_id, data->fw_id, 2) != 0 ||
+        blob.sensitivity != data->settings.sensitivity) {
+        LOG_INF("Saved calibration does not match, recalibrating");
+        return -ESTALE;
+    }
+
+    pinnacle_pass_begin(dev);
+    ret = pinnacle_era_write(dev, CONFIG_INPUT_PINNACLE_CAL_CACHE_ERA_ADDR, blob.comp,
+                             sizeof(blob.comp));
+    if (ret >= 0) {
+        ret = pinnacle_era_read(dev, CONFIG_INPUT_PINNACLE_CAL_CACHE_ERA_ADDR, check,
+                                sizeof(check));
+    }
+    int end = pinnacle_pass_end(dev);
+    if (ret >= 0) {
+        ret = end;
+    }
+    if (ret < 0) {
+        LOG_ERR("Failed to restore calibration %d", ret);
+        return ret;
+    }
+
+    if (memcmp(check, blob.comp, sizeof(check)) != 0) {
+        LOG_WRN("Restored calibration did not read back, recalibrating");
+        return -EIO;
+    }
+
+    LOG_DBG("Restored saved calibration");
+    return 0;
+}
+
+static int pinnacle_cal_save(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+    struct pinnacle_cal_blob blob = {
+        .fw_id = {data->fw_id[0], data->fw_id[1]},
+        .sensitivity = data->settings.sensitivity,
+    };
+    char key[64];
+
+    pinnacle_pass_begin(dev);
+    int ret = pinnacle_era_read(dev, CONFIG_INPUT_PINNACLE_CAL_CACHE_ERA_ADDR, blob.comp,
+                                sizeof(blob.comp));
+    int end = pinnacle_pass_end(dev);
+    if (ret >= 0) {
+        ret = end;
+    }
+    if (ret < 0) {
+        LOG_ERR("Failed to read calibration %d", ret);
+        return ret;
+    }
+
+    blob.crc = pinnacle_cal_crc(&blob);
+    pinnacle_cal_key(dev, key, sizeof(key));
+
+    ret = settings_save_one(key, &blob, sizeof(blob));
+    if (ret < 0) {
+        LOG_ERR("Failed to save calibration %d", ret);
+    }
+
+    return ret;
+}
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_CAL_CACHE)
+
+static int pinnacle_run_calibration(const struct device *dev) {
+    int ret = pinnacle_force_recalibrate(dev);
+    if (ret < 0) {
+        return ret;
+    }
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_CAL_CACHE)
+    // Only worth a log; the fresh calibration is in place either way
+    pinnacle_cal_save(dev);
+#endif
+
+    return 0;
+}
+
+// Uses the saved calibration when there is a valid one, otherwise calibrates from scratch
+static int pinnacle_calibrate(const struct device *dev) {
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_CAL_CACHE)
+    if (pinnacle_cal_restore(dev) == 0) {
+        return 0;
+    }
+#endif
+
+    return pinnacle_run_calibration(dev);
+}
+
+static int pinnacle_update_sleep(const struct device *dev, bool enabled) {
+    LOG_DBG("Setting sleep: %s", (enabled ? "on" : "off"));
+
+    int ret = pinnacle_cached_update(dev, PINNACLE_SYS_CFG, PINNACLE_SYS_CFG_EN_SLEEP,
+                                     enabled ? PINNACLE_SYS_CFG_EN_SLEEP : 0);
+    if (ret < 0) {
+        LOG_ERR("can't write sleep config %d", ret);
+    }
+
+    return ret;
+}
+
+static uint8_t pinnacle_feed_cfg1(const struct device *dev) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_data *data = dev->data;
+    uint8_t feed_cfg1 = PINNACLE_FEED_CFG1_EN_FEED;
+
+    if (config->absolute) {
+        feed_cfg1 |= PINNACLE_FEED_CFG1_ABS_MODE;
+    }
+
+    if (data->settings.x_invert) {
+        feed_cfg1 |= PINNACLE_FEED_CFG1_INV_X;
+    }
+
+    if (data->settings.y_invert) {
+        feed_cfg1 |= PINNACLE_FEED_CFG1_INV_Y;
+    }
+
+    return feed_cfg1;
+}
+
+static uint8_t pinnacle_feed_cfg2(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+    uint8_t feed_cfg2 = PINNACLE_FEED_CFG2_EN_IM | PINNACLE_FEED_CFG2_EN_BTN_SCRL;
+
+    if (data->settings.no_taps) {
+        feed_cfg2 |= PINNACLE_FEED_CFG2_DIS_TAP;
+    }
+
+    if (data->settings.no_secondary_tap) {
+        feed_cfg2 |= PINNACLE_FEED_CFG2_DIS_SEC;
+    }
+
+    if (data->settings.rotate_90) {
+        feed_cfg2 |= PINNACLE_FEED_CFG2_ROTATE_90;
+    }
+
+    return feed_cfg2;
+}
+
+static int pinnacle_reset(const struct device *dev) {
+    int ret = pinnacle_write(dev, PINNACLE_STATUS1, 0); // Clear CC
+    if (ret < 0) {
+        LOG_ERR("can't write %d", ret);
+        return ret;
+    }
+    k_usleep(50);
+    ret = pinnacle_write(dev, PINNACLE_SYS_CFG, PINNACLE_SYS_CFG_RESET);
+    if (ret < 0) {
+        LOG_ERR("can't reset %d", ret);
+        return ret;
+    }
+
+    // Everything goes back to defaults; pinnacle_configure() reloads the shadow
+    pinnacle_shadow_invalidate(dev);
+
+    return 0;
+}
+
+// Everything after the post-reset settle time: tuning, calibration and feed configuration
+static int pinnacle_configure(const struct device *dev) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_data *data = dev->data;
+    int ret;
+
+    // Every settings read comes after this, so only a change made from here on needs rewriting
+    atomic_clear_bit(&data->flags, PINNACLE_FLAG_SETTINGS_DIRTY);
+
+    ret = pinnacle_shadow_load(dev);
+    if (ret < 0) {
+        return ret;
+    }
+
+    LOG_DBG("Default sleep interval %d",
+            data->shadow.regs[PINNACLE_SLEEP_INTERVAL - PINNACLE_SHADOW_FIRST]);
+
+    ret = pinnacle_cached_write(dev, PINNACLE_Z_IDLE, 0x05); // No Z-Idle packets
+    if (ret < 0) {
+        LOG_ERR("can't write %d", ret);
+        return ret;
+    }
+
+    ret = pinnacle_write_sample_rate(dev, data->sample_rate);
+    if (ret < 0) {
+        return ret;
+    }
+
+    ret = pinnacle_era_init(dev);
+    if (ret < 0) {
+        return ret;
+    }
+
+    ret = pinnacle_calibrate(dev);
+    if (ret < 0) {
+        LOG_ERR("Failed to force recalibration %d", ret);
+        return ret;
+    }
+
+    if (config->sleep_en) {
+        ret = pinnacle_update_sleep(dev, true);
+        if (ret < 0) {
+            return ret;
+        }
+    }
+
+    ret = pinnacle_cached_write(dev, PINNACLE_SLEEP_INTERVAL, config->sleep_interval);
+    if (ret < 0) {
+        LOG_DBG("Failed to update sleep interaval %d", ret);
+    }
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ADAPTIVE_SLEEP)
+    data->sleep_interval = config->sleep_interval;
+#endif
+
+    if (config->sleep_timer >= 0) {
+        ret = pinnacle_cached_write(dev, PINNACLE_SLEEP_TIMER, config->sleep_timer);
+        if (ret < 0) {
+            LOG_DBG("Failed to update sleep timer %d", ret);
+        }
+    }
+
+    ret = pinnacle_cached_write(dev, PINNACLE_FEED_CFG2, pinnacle_feed_cfg2(dev));
+    if (ret < 0) {
+        LOG_ERR("can't write %d", ret);
+        return ret;
+    }
+
+    uint8_t feed_cfg1 = pinnacle_feed_cfg1(dev);
+    ret = pinnacle_cached_write(dev, PINNACLE_FEED_CFG1, feed_cfg1);
+    if (ret < 0) {
+        LOG_ERR("can't write %d", ret);
+        return ret;
+    }
+
+    pinnacle_clear_status(dev);
+
+    pinnacle_write(dev, PINNACLE_FEED_CFG1, feed_cfg1);
+
+    set_int(dev, true);
+
+    return 0;
+}
+
+static void pinnacle_set_ready(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+
+    atomic_clear_bit(&data->flags, PINNACLE_FLAG_FAILED);
+    atomic_set_bit(&data->flags, PINNACLE_FLAG_READY);
+    // Latched: every waiter takes and immediately returns it
+    k_sem_give(&data->ready_sem);
+}
+
+bool pinnacle_is_ready(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+
+    return atomic_test_bit(&data->flags, PINNACLE_FLAG_READY);
+}
+
+// Error for a call made before bring-up finished: -EIO once it has given up, -EAGAIN until then
+static int pinnacle_not_ready(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+
+    return atomic_test_bit(&data->flags, PINNACLE_FLAG_FAILED) ? -EIO : -EAGAIN;
+}
+
+int pinnacle_set_sleep(const struct device *dev, bool enabled) {
+    if (!pinnacle_is_ready(dev)) {
+        return pinnacle_not_ready(dev);
+    }
+
+    return pinnacle_update_sleep(dev, enabled);
+}
+
+int pinnacle_resync(const struct device *dev) {
+    if (!pinnacle_is_ready(dev)) {
+        return pinnacle_not_ready(dev);
+    }
+
+    return pinnacle_shadow_load(dev);
+}
+
+// Runs on the driver's work queue, so no report work or async step can touch the bus meanwhile
+static void pinnacle_sync_work_cb(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct pinnacle_data *data = CONTAINER_OF(dwork, struct pinnacle_data, sync_work);
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+    // A chain owns the bus between its steps; new ones can't start once the pass has begun
+    if (atomic_test_bit(&data->async_flags, PINNACLE_ASYNC_BUSY)) {
+        pinnacle_schedule_work(dwork, K_MSEC(1));
+        return;
+    }
+#endif
+
+    // The chip is shut down; PM suspend can't flush this item when it runs on the same queue
+    if (atomic_test_bit(&data->flags, PINNACLE_FLAG_SUSPENDED)) {
+        data->sync_result = -EBUSY;
+    } else {
+        data->sync_result = data->sync_fn(data->dev, data->sync_arg);
+    }
+    k_sem_give(&data->sync_done);
+}
+
+/*
+ * Runs fn on the driver's work queue, between packets, and blocks until it returns, so bus and
+ * shadow access from an API call never interleaves with report work or the DR watchdog.
+ */
+static int pinnacle_run_sync(const struct device *dev, pinnacle_sync_fn_t fn, const void *arg) {
+    struct pinnacle_data *data = dev->data;
+
+    if (pinnacle_on_work_queue()) {
+        return atomic_test_bit(&data->flags, PINNACLE_FLAG_SUSPENDED) ? -EBUSY : fn(dev, arg);
+    }
+
+    k_mutex_lock(&data->sync_lock, K_FOREVER);
+    data->sync_fn = fn;
+    data->sync_arg = arg;
+    k_sem_reset(&data->sync_done);
+    pinnacle_schedule_work(&data->sync_work, K_NO_WAIT);
+    k_sem_take(&data->sync_done, K_FOREVER);
+    int ret = data->sync_result;
+    k_mutex_unlock(&data->sync_lock);
+
+    return ret;
+}
+
+static int pinnacle_recalibrate_sync(const struct device *dev, const void *arg) {
+    ARG_UNUSED(arg);
+
+    return pinnacle_run_calibration(dev);
+}
+
+int pinnacle_recalibrate(const struct device *dev) {
+    if (!pinnacle_is_ready(dev)) {
+        return pinnacle_not_ready(dev);
+    }
+
+    return pinnacle_run_sync(dev, pinnacle_recalibrate_sync, NULL);
+}
+
+// On the work queue, where the adaptive sample rate also changes these fields
+static int pinnacle_set_sample_rate_sync(const struct device *dev, const void *arg) {
+    struct pinnacle_data *data = dev->data;
+    uint8_t rate = *(const uint8_t *)arg;
+
+    int ret = pinnacle_write_sample_rate(dev, rate);
+    if (ret < 0) {
+        return ret;
+    }
+
+    data->sample_rate = rate;
+    data->idle_packets = 0;
+    return 0;
+}
+
+int pinnacle_set_sample_rate(const struct device *dev, uint8_t rate) {
+    if (!pinnacle_sample_rate_valid(rate)) {
+        return -EINVAL;
+    }
+
+    if (!pinnacle_is_ready(dev)) {
+        return pinnacle_not_ready(dev);
+    }
+
+    return pinnacle_run_sync(dev, pinnacle_set_sample_rate_sync, &rate);
+}
+
+int pinnacle_get_settings(const struct device *dev, struct pinnacle_settings *settings) {
+    struct pinnacle_data *data = dev->data;
+
+    // Both held, so a request being applied shows up either as pending or as applied
+    k_mutex_lock(&data->lock, K_FOREVER);
+    k_spinlock_key_t key = k_spin_lock(&data->settings_lock);
+
+    *settings = data->pending_seq != data->applied_seq ? data->pending_settings : data->settings;
+    k_spin_unlock(&data->settings_lock, key);
+    k_mutex_unlock(&data->lock);
+    return 0;
+}
+
+/*
+ * Writes what differs between old and data->settings, or everything when old is NULL; feed
+ * registers are skipped by the shadow either way.
+ */
+static int pinnacle_apply_settings(const struct device *dev, const struct pinnacle_settings *old) {
+    struct pinnacle_data *data = dev->data;
+    const struct pinnacle_settings *new = &data->settings;
+
+    int ret = pinnacle_cached_write(dev, PINNACLE_FEED_CFG2, pinnacle_feed_cfg2(dev));
+    if (ret < 0) {
+        LOG_ERR("can't write %d", ret);
+        return ret;
+    }
+
+    ret = pinnacle_cached_write(dev, PINNACLE_FEED_CFG1, pinnacle_feed_cfg1(dev));
+    if (ret < 0) {
+        LOG_ERR("can't write %d", ret);
+        return ret;
+    }
+
+    bool sensitivity = !old || new->sensitivity != old->sensitivity;
+    bool z_min = !old || new->x_axis_z_min != old->x_axis_z_min ||
+                 new->y_axis_z_min != old->y_axis_z_min;
+    if (!sensitivity && !z_min) {
+        return 0;
+    }
+
+    pinnacle_pass_begin(dev);
+
+    if (sensitivity) {
+        ret = pinnacle_set_adc_tracking_sensitivity(dev);
+    }
+
+    if (ret >= 0 && z_min) {
+        ret = pinnacle_write_z_min(dev);
+    }
+
+    int end = pinnacle_pass_end(dev);
+    return ret < 0 ? ret : end;
+}
+
+// Always on the driver's work queue, through pinnacle_run_sync()
+static int pinnacle_update_settings_sync(const struct device *dev, const void *arg) {
+    struct pinnacle_data *data = dev->data;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    struct pinnacle_settings old = data->settings;
+
+    data->settings = *(const struct pinnacle_settings *)arg;
+
+    int ret = pinnacle_apply_settings(dev, &old);
+    if (ret < 0) {
+        // Retrying compares against the old values again, so every change is rewritten
+        data->settings = old;
+    }
+
+    k_mutex_unlock(&data->lock);
+    return ret;
+}
+
+static int pinnacle_update_settings(const struct device *dev,
+                                    const struct pinnacle_settings *settings) {
+    struct pinnacle_data *data = dev->data;
+
+    if (settings->sensitivity > PINNACLE_SENSITIVITY_4X) {
+        return -EINVAL;
+    }
+
+    int ret = 0;
+
+    // Bring-up reports ready under the same lock, so the change lands either before or after it
+    k_mutex_lock(&data->lock, K_FOREVER);
+    bool ready = pinnacle_is_ready(dev);
+
+    if (!ready && atomic_test_bit(&data->flags, PINNACLE_FLAG_FAILED)) {
+        ret = -EIO;
+    } else if (!ready) {
+        // Bring-up writes the new values, or rewrites them at its end if it read the old ones
+        data->settings = *settings;
+        atomic_set_bit(&data->flags, PINNACLE_FLAG_SETTINGS_DIRTY);
+    }
+    k_mutex_unlock(&data->lock);
+
+    if (!ready) {
+        return ret;
+    }
+
+    return pinnacle_run_sync(dev, pinnacle_update_settings_sync, settings);
+}
+
+/*
+ * Ends a successful bring-up. Settings changed while it ran may have missed the configure pass,
+ * so they are rewritten first, and holding the lock keeps further changes out until ready is set.
+ */
+static int pinnacle_finish_bringup(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+    int ret = 0;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    if (atomic_test_and_clear_bit(&data->flags, PINNACLE_FLAG_SETTINGS_DIRTY)) {
+        ret = pinnacle_apply_settings(dev, NULL);
+    }
+
+    if (ret >= 0) {
+        pinnacle_set_ready(dev);
+    }
+    k_mutex_unlock(&data->lock);
+
+    return ret;
+}
+
+int pinnacle_set_settings(const struct device *dev, const struct pinnacle_settings *settings) {
+    if (!pinnacle_is_ready(dev)) {
+        return pinnacle_not_ready(dev);
+    }
+
+    int ret = pinnacle_update_settings(dev, settings);
+    if (ret < 0) {
+        return ret;
+    }
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_SETTINGS)
+    struct pinnacle_data *data = dev->data;
+
+    // Debounced so a burst of changes costs one flash write
+    k_work_reschedule(&data->save_work, K_MSEC(CONFIG_INPUT_PINNACLE_SETTINGS_SAVE_DELAY_MS));
+#endif
+
+    return 0;
+}
+
+static void pinnacle_settings_work_cb(struct k_work *work) {
+    struct pinnacle_data *data = CONTAINER_OF(work, struct pinnacle_data, settings_work);
+    struct pinnacle_settings settings;
+    k_spinlock_key_t key = k_spin_lock(&data->settings_lock);
+    uint32_t seq = data->pending_seq;
+
+    settings = data->pending_settings;
+    k_spin_unlock(&data->settings_lock, key);
+
+    int ret = pinnacle_set_settings(data->dev, &settings);
+    if (ret < 0) {
+        LOG_ERR("Failed to apply settings %d", ret);
+    }
+
+    // A request that came in meanwhile stays pending; its own submission applies it
+    key = k_spin_lock(&data->settings_lock);
+    data->applied_seq = seq;
+    k_spin_unlock(&data->settings_lock, key);
+}
+
+int pinnacle_set_settings_async(const struct device *dev,
+                                const struct pinnacle_settings *settings) {
+    struct pinnacle_data *data = dev->data;
+
+    if (settings->sensitivity > PINNACLE_SENSITIVITY_4X) {
+        return -EINVAL;
     }
 
-    if (!config->no_taps && (btn || data->btn_cache)) {
-        for (int i = 0; i < 3; i++) {
-            uint8_t btn_val = btn & BIT(i);
-            if (btn_val != (data->btn_cache & BIT(i))) {
-                input_report_key(dev, INPUT_BTN_0 + i, btn_val ? 1 : 0, false, K_FOREVER);
-            }
-        }
+    if (!pinnacle_is_ready(dev)) {
+        return pinnacle_not_ready(dev);
     }
 
-    data->btn_cache = btn;
+    k_spinlock_key_t key = k_spin_lock(&data->settings_lock);
 
-    input_report_rel(dev, INPUT_REL_X, dx, false, K_FOREVER);
-    input_report_rel(dev, INPUT_REL_Y, dy, true, K_FOREVER);
+    data->pending_settings = *settings;
+    data->pending_seq++;
+    k_spin_unlock(&data->settings_lock, key);
 
-    return;
+    pinnacle_submit_work(&data->settings_work);
+    return 0;
 }
 
-static void pinnacle_work_cb(struct k_work *work) {
-    struct pinnacle_data *data = CONTAINER_OF(work, struct pinnacle_data, work);
-    pinnacle_report_data(data->dev);
-}
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_SETTINGS)
 
-static void pinnacle_gpio_cb(const struct device *port, struct gpio_callback *cb, uint32_t pins) {
-    struct pinnacle_data *data = CONTAINER_OF(cb, struct pinnacle_data, gpio_cb);
+#define PINNACLE_SETTINGS_ROOT "pinnacle"
 
-    LOG_DBG("HW DR asserted");
-    data->in_int = true;
-    k_work_submit(&data->work);
-}
+// Runs on the system work queue so flash writes never stall packet handling
+static void pinnacle_save_work_cb(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct pinnacle_data *data = CONTAINER_OF(dwork, struct pinnacle_data, save_work);
+    struct pinnacle_settings settings;
+    char key[64];
 
-static int pinnacle_adc_sensitivity_reg_value(enum pinnacle_sensitivity sensitivity) {
-    switch (sensitivity) {
-    case PINNACLE_SENSITIVITY_1X:
-        return PINNACLE_TRACKING_ADC_CONFIG_1X;
-    case PINNACLE_SENSITIVITY_2X:
-        return PINNACLE_TRACKING_ADC_CONFIG_2X;
-    case PINNACLE_SENSITIVITY_3X:
-        return PINNACLE_TRACKING_ADC_CONFIG_3X;
-    case PINNACLE_SENSITIVITY_4X:
-        return PINNACLE_TRACKING_ADC_CONFIG_4X;
-    default:
-        return PINNACLE_TRACKING_ADC_CONFIG_1X;
+    // Copied first, so a change applied meanwhile on the driver work queue can't tear it
+    k_mutex_lock(&data->lock, K_FOREVER);
+    settings = data->settings;
+    k_mutex_unlock(&data->lock);
+
+    snprintf(key, sizeof(key), PINNACLE_SETTINGS_ROOT "/%s", data->dev->name);
+    int ret = settings_save_one(key, &settings, sizeof(settings));
+    if (ret < 0) {
+        LOG_ERR("Failed to save settings %d", ret);
     }
 }
 
-static int pinnacle_tune_edge_sensitivity(const struct device *dev) {
-    const struct pinnacle_config *config = dev->config;
-    int ret;
+// Key is the device name; the saved settings are applied as one batch per device
+static int pinnacle_settings_set(const char *name, size_t len, settings_read_cb read_cb,
+                                 void *cb_arg) {
+    const struct device *dev = device_get_binding(name);
+    struct pinnacle_settings settings;
 
-    uint8_t x_val;
-    ret = pinnacle_era_read(dev, PINNACLE_ERA_REG_X_AXIS_WIDE_Z_MIN, &x_val);
-    if (ret < 0) {
-        LOG_WRN("Failed to read X val");
-        return ret;
+    if (!dev) {
+        LOG_WRN("No device for saved settings %s", name);
+        return 0;
     }
 
-    LOG_WRN("X val: %d", x_val);
+    if (len != sizeof(settings)) {
+        LOG_WRN("Ignoring saved settings for %s with size %zu", name, len);
+        return 0;
+    }
 
-    uint8_t y_val;
-    ret = pinnacle_era_read(dev, PINNACLE_ERA_REG_Y_AXIS_WIDE_Z_MIN, &y_val);
+    int ret = read_cb(cb_arg, &settings, sizeof(settings));
     if (ret < 0) {
-        LOG_WRN("Failed to read Y val");
         return ret;
     }
 
-    LOG_WRN("Y val: %d", y_val);
+    // Usually a no-op, since bring-up already started from them, see pinnacle_settings_load()
+    return pinnacle_update_settings(dev, &settings);
+}
 
-    ret = pinnacle_era_write(dev, PINNACLE_ERA_REG_X_AXIS_WIDE_Z_MIN, config->x_axis_z_min);
-    if (ret < 0) {
-        LOG_ERR("Failed to set X-Axis Min-Z %d", ret);
-        return ret;
+static int pinnacle_settings_load_cb(const char *key, size_t len, settings_read_cb read_cb,
+                                     void *cb_arg, void *param) {
+    struct pinnacle_data *data = param;
+    struct pinnacle_settings settings;
+
+    if (len != sizeof(settings)) {
+        LOG_WRN("Ignoring saved settings with size %zu", len);
+        return 0;
     }
-    ret = pinnacle_era_write(dev, PINNACLE_ERA_REG_Y_AXIS_WIDE_Z_MIN, config->y_axis_z_min);
+
+    int ret = read_cb(cb_arg, &settings, sizeof(settings));
     if (ret < 0) {
-        LOG_ERR("Failed to set Y-Axis Min-Z %d", ret);
         return ret;
     }
+
+    if (settings.sensitivity > PINNACLE_SENSITIVITY_4X) {
+        LOG_WRN("Ignoring saved settings with sensitivity %d", settings.sensitivity);
+        return -EINVAL;
+    }
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    data->settings = settings;
+    k_mutex_unlock(&data->lock);
     return 0;
 }
 
-static int pinnacle_set_adc_tracking_sensitivity(const struct device *dev) {
-    const struct pinnacle_config *config = dev->config;
+/*
+ * Reads the saved settings into data->settings before the first configure pass, so boot writes
+ * them in the same batch as the rest of the configuration instead of rewriting the devicetree
+ * values afterwards. Like the calibration cache, this needs the settings subsystem initialized
+ * before bring-up; otherwise the settings handler applies them once they are loaded.
+ */
+static void pinnacle_settings_load(const struct device *dev) {
+    char key[64];
+
+    snprintf(key, sizeof(key), PINNACLE_SETTINGS_ROOT "/%s", dev->name);
+    settings_load_subtree_direct(key, pinnacle_settings_load_cb, dev->data);
+}
 
-    uint8_t val;
-    int ret = pinnacle_era_read(dev, PINNACLE_ERA_REG_TRACKING_ADC_CONFIG, &val);
-    if (ret < 0) {
-        LOG_ERR("Failed to get ADC sensitivity %d", ret);
-    }
+SETTINGS_STATIC_HANDLER_DEFINE(pinnacle, PINNACLE_SETTINGS_ROOT, NULL, pinnacle_settings_set, NULL,
+                               NULL);
 
-    val &= 0x3F;
-    val |= pinnacle_adc_sensitivity_reg_value(config->sensitivity);
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_SETTINGS)
 
-    ret = pinnacle_era_write(dev, PINNACLE_ERA_REG_TRACKING_ADC_CONFIG, val);
-    if (ret < 0) {
-        LOG_ERR("Failed to set ADC sensitivity %d", ret);
-    }
-    ret = pinnacle_era_read(dev, PINNACLE_ERA_REG_TRACKING_ADC_CONFIG, &val);
+int pinnacle_wait_ready(const struct device *dev, k_timeout_t timeout) {
+    struct pinnacle_data *data = dev->data;
+
+    int ret = k_sem_take(&data->ready_sem, timeout);
     if (ret < 0) {
-        LOG_ERR("Failed to get ADC sensitivity %d", ret);
+        return ret;
     }
 
-    return ret;
+    k_sem_give(&data->ready_sem);
+    return atomic_test_bit(&data->flags, PINNACLE_FLAG_FAILED) ? -EIO : 0;
 }
 
-static int pinnacle_force_recalibrate(const struct device *dev) {
-    uint8_t val;
-    int ret = pinnacle_seq_read(dev, PINNACLE_CAL_CFG, &val, 1);
-    if (ret < 0) {
-        LOG_ERR("Failed to get cal config %d", ret);
-    }
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_DEFERRED_INIT)
 
-    val |= 0x01;
-    ret = pinnacle_write(dev, PINNACLE_CAL_CFG, val);
-    if (ret < 0) {
-        LOG_ERR("Failed to force calibration %d", ret);
-    }
+// First retry delay after a failed bring-up; doubles with each further attempt
+#define PINNACLE_INIT_RETRY_MS 50
 
-    do {
-        pinnacle_seq_read(dev, PINNACLE_CAL_CFG, &val, 1);
-    } while (val & 0x01);
+enum pinnacle_init_step {
+    PINNACLE_INIT_STEP_RESET,
+    PINNACLE_INIT_STEP_CONFIGURE,
+};
 
-    return ret;
-}
+static void pinnacle_init_work_cb(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct pinnacle_data *data = CONTAINER_OF(dwork, struct pinnacle_data, init_work);
+    const struct device *dev = data->dev;
+    int ret;
 
-int pinnacle_set_sleep(const struct device *dev, bool enabled) {
-    uint8_t sys_cfg;
-    int ret = pinnacle_seq_read(dev, PINNACLE_SYS_CFG, &sys_cfg, 1);
-    if (ret < 0) {
-        LOG_ERR("can't read sys config %d", ret);
-        return ret;
-    }
+    switch (data->init_step) {
+    case PINNACLE_INIT_STEP_RESET:
+        ret = pinnacle_reset(dev);
+        if (ret < 0) {
+            break;
+        }
 
-    if (((sys_cfg & PINNACLE_SYS_CFG_EN_SLEEP) != 0) == enabled) {
-        return 0;
+        // Let the reset settle without holding the work queue
+        data->init_step = PINNACLE_INIT_STEP_CONFIGURE;
+        pinnacle_schedule_work(&data->init_work, K_MSEC(20));
+        return;
+    case PINNACLE_INIT_STEP_CONFIGURE:
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_SETTINGS)
+        if (data->init_retries == 0) {
+            pinnacle_settings_load(dev);
+        }
+#endif
+        ret = pinnacle_configure(dev);
+        if (ret < 0) {
+            break;
+        }
+
+        ret = pinnacle_finish_bringup(dev);
+        if (ret < 0) {
+            break;
+        }
+
+        LOG_INF("%s ready after %u ms", dev->name, k_uptime_get_32() - data->init_start_ms);
+        return;
+    default:
+        ret = -EINVAL;
+        break;
     }
 
-    LOG_DBG("Setting sleep: %s", (enabled ? "on" : "off"));
-    WRITE_BIT(sys_cfg, PINNACLE_SYS_CFG_EN_SLEEP_BIT, enabled ? 1 : 0);
+    if (data->init_retries < CONFIG_INPUT_PINNACLE_DEFERRED_INIT_RETRIES) {
+        uint32_t delay_ms = PINNACLE_INIT_RETRY_MS << data->init_retries++;
 
-    ret = pinnacle_write(dev, PINNACLE_SYS_CFG, sys_cfg);
-    if (ret < 0) {
-        LOG_ERR("can't write sleep config %d", ret);
-        return ret;
+        LOG_WRN("Deferred init failed in step %d: %d, retrying in %u ms", data->init_step, ret,
+                delay_ms);
+        data->init_step = PINNACLE_INIT_STEP_RESET;
+        pinnacle_schedule_work(&data->init_work, K_MSEC(delay_ms));
+        return;
     }
 
-    return ret;
+    LOG_ERR("Deferred init failed in step %d: %d", data->init_step, ret);
+    // Wakes pinnacle_wait_ready() callers, which see the failure instead of timing out
+    atomic_set_bit(&data->flags, PINNACLE_FLAG_FAILED);
+    k_sem_give(&data->ready_sem);
 }
 
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_DEFERRED_INIT)
+
 static int pinnacle_init(const struct device *dev) {
     struct pinnacle_data *data = dev->data;
     const struct pinnacle_config *config = dev->config;
     int ret;
 
-    uint8_t fw_id[2];
-    ret = pinnacle_seq_read(dev, PINNACLE_FW_ID, fw_id, 2);
+#if PINNACLE_BUS_SPI
+    if (config->spi_bufs) {
+        k_mutex_init(&config->spi_bufs->lock);
+    }
+#endif
+    k_mutex_init(&data->lock);
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_STATS)
+    stats_init(&data->stats.s_hdr, STATS_SIZE_32,
+               (sizeof(data->stats) - sizeof(struct stats_hdr)) / sizeof(uint32_t),
+               STATS_NAME_INIT_PARMS(pinnacle));
+    stats_register(dev->name, &data->stats.s_hdr);
+#endif
+
+    ret = pinnacle_seq_read(dev, PINNACLE_FW_ID, data->fw_id, 2);
     if (ret < 0) {
         LOG_ERR("Failed to get the FW ID %d", ret);
+        memset(data->fw_id, 0, sizeof(data->fw_id));
     }
 
-    LOG_DBG("Found device with FW ID: 0x%02x, Version: 0x%02x", fw_id[0], fw_id[1]);
+    LOG_DBG("Found device with FW ID: 0x%02x, Version: 0x%02x", data->fw_id[0], data->fw_id[1]);
 
     data->in_int = false;
-    k_msleep(10);
-    ret = pinnacle_write(dev, PINNACLE_STATUS1, 0); // Clear CC
-    if (ret < 0) {
-        LOG_ERR("can't write %d", ret);
-        return ret;
+    data->dev = dev;
+    data->sample_rate = config->sample_rate;
+    data->settings = (struct pinnacle_settings){
+        .sensitivity = config->sensitivity,
+        .x_invert = config->x_invert,
+        .y_invert = config->y_invert,
+        .rotate_90 = config->rotate_90,
+        .no_taps = config->no_taps,
+        .no_secondary_tap = config->no_secondary_tap,
+        .x_axis_z_min = config->x_axis_z_min,
+        .y_axis_z_min = config->y_axis_z_min,
+    };
+
+    // DR handling is set up before the chip is configured so completion waits can use it
+    if (config->dr.port) {
+        gpio_pin_configure_dt(&config->dr, GPIO_INPUT);
+        gpio_init_callback(&data->gpio_cb, pinnacle_gpio_cb, BIT(config->dr.pin));
+        ret = gpio_add_callback(config->dr.port, &data->gpio_cb);
+        if (ret < 0) {
+            LOG_ERR("Failed to set DR callback: %d", ret);
+            return -EIO;
+        }
     }
-    k_usleep(50);
-    ret = pinnacle_write(dev, PINNACLE_SYS_CFG, PINNACLE_SYS_CFG_RESET);
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_POLL)
+    k_timer_init(&data->poll_timer, pinnacle_poll_timer_cb, NULL);
+#endif
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_WORKQUEUE)
+    pinnacle_work_q_start();
+#endif
+    k_work_init(&data->work, pinnacle_work_cb);
+    k_work_init(&data->settings_work, pinnacle_settings_work_cb);
+    k_work_init_delayable(&data->sync_work, pinnacle_sync_work_cb);
+    k_sem_init(&data->sync_done, 0, 1);
+    k_mutex_init(&data->sync_lock);
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_COALESCE)
+    k_work_init_delayable(&data->flush_work, pinnacle_flush_work_cb);
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+    k_work_init(&data->async_work, pinnacle_async_work_cb);
+    k_msgq_init(&data->async_msgq, data->async_msgq_buf, PINNACLE_PACKET_MAX_LEN,
+                PINNACLE_ASYNC_QUEUE_LEN);
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_WAIT_ON_DR)
+    k_sem_init(&data->cc_sem, 0, 1);
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_SETTINGS)
+    k_work_init_delayable(&data->save_work, pinnacle_save_work_cb);
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ADAPTIVE_SLEEP)
+    k_work_init_delayable(&data->sleep_work, pinnacle_sleep_work_cb);
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_DR_WATCHDOG)
+    k_work_init_delayable(&data->dr_watchdog, pinnacle_dr_watchdog_cb);
+#endif
+
+    k_sem_init(&data->ready_sem, 0, 1);
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_DEFERRED_INIT)
+    // Register now and finish bring-up in the background; pinnacle_wait_ready() tracks it
+    data->init_start_ms = k_uptime_get_32();
+    data->init_step = PINNACLE_INIT_STEP_RESET;
+    data->init_retries = 0;
+    k_work_init_delayable(&data->init_work, pinnacle_init_work_cb);
+    pinnacle_schedule_work(&data->init_work, K_MSEC(10));
+
+    return 0;
+#else
+    k_msleep(10);
+    ret = pinnacle_reset(dev);
     if (ret < 0) {
-        LOG_ERR("can't reset %d", ret);
         return ret;
     }
     k_msleep(20);
-    ret = pinnacle_write(dev, PINNACLE_Z_IDLE, 0x05); // No Z-Idle packets
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_SETTINGS)
+    pinnacle_settings_load(dev);
+#endif
+    ret = pinnacle_configure(dev);
     if (ret < 0) {
-        LOG_ERR("can't write %d", ret);
         return ret;
     }
 
-    ret = pinnacle_set_adc_tracking_sensitivity(dev);
+    return pinnacle_finish_bringup(dev);
+#endif
+}
+
+#if IS_ENABLED(CONFIG_PM_DEVICE)
+
+static int pinnacle_set_shutdown(const struct device *dev, bool shutdown) {
+    int ret = pinnacle_cached_update(dev, PINNACLE_SYS_CFG, PINNACLE_SYS_CFG_SHUTDOWN,
+                                     shutdown ? PINNACLE_SYS_CFG_SHUTDOWN : 0);
     if (ret < 0) {
-        LOG_ERR("Failed to set ADC sensitivity %d", ret);
-        return ret;
+        LOG_ERR("can't %s shutdown %d", shutdown ? "enter" : "leave", ret);
     }
 
-    ret = pinnacle_tune_edge_sensitivity(dev);
-    if (ret < 0) {
-        LOG_ERR("Failed to tune edge sensitivity %d", ret);
-        return ret;
+    return ret;
+}
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+
+// Same deadline and backoff as the completion waits, so a callback that never comes can't hang PM
+static int pinnacle_async_wait_idle(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+    int64_t deadline = k_uptime_get() + CONFIG_INPUT_PINNACLE_WAIT_TIMEOUT_MS;
+    uint32_t backoff_us = CONFIG_INPUT_PINNACLE_WAIT_POLL_MIN_US;
+
+    while (atomic_test_bit(&data->async_flags, PINNACLE_ASYNC_BUSY)) {
+        if (k_uptime_get() >= deadline) {
+            LOG_ERR("Timed out waiting for the async transfer in flight");
+            return -ETIMEDOUT;
+        }
+
+        k_usleep(backoff_us);
+        backoff_us = MIN(backoff_us * 2, CONFIG_INPUT_PINNACLE_WAIT_POLL_MAX_US);
     }
-    ret = pinnacle_force_recalibrate(dev);
-    if (ret < 0) {
-        LOG_ERR("Failed to force recalibration %d", ret);
-        return ret;
+
+    return 0;
+}
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+
+/*
+ * Stops everything that could still reach the bus or rearm itself: the DR interrupt and poll
+ * timer, report and watchdog work, the async chain and the timers feeding off packets. Work that
+ * slips through sees PINNACLE_FLAG_SUSPENDED and does nothing. Fails with -ETIMEDOUT, leaving the
+ * pad running, if an async transfer doesn't complete in time.
+ */
+static int pinnacle_pm_quiesce(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+    struct k_work_sync sync;
+    bool on_work_queue = pinnacle_on_work_queue();
+
+    // A running ERA pass rearms the interrupt as it ends, so let it finish first. On the work
+    // queue itself nothing else can be running, and flushing would deadlock.
+    if (!on_work_queue) {
+        k_work_flush_delayable(&data->sync_work, &sync);
+        k_work_flush(&data->settings_work, &sync);
     }
 
-    if (config->sleep_en) {
-        ret = pinnacle_set_sleep(dev, true);
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+    bool was_suspended = atomic_test_bit(&data->flags, PINNACLE_FLAG_SUSPENDED);
+#endif
+
+    atomic_set_bit(&data->flags, PINNACLE_FLAG_SUSPENDED);
+    set_int(dev, false);
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+    atomic_clear_bit(&data->async_flags, PINNACLE_ASYNC_PENDING);
+    // The chain stops after the transfer in flight. Its steps run on the work queue, so from
+    // there the bus lock is what keeps that transfer ahead of the shutdown write.
+    if (!on_work_queue) {
+        int ret = pinnacle_async_wait_idle(dev);
         if (ret < 0) {
+            // The action fails and PM keeps the previous state, so the pad has to match it
+            if (!was_suspended) {
+                atomic_clear_bit(&data->flags, PINNACLE_FLAG_SUSPENDED);
+                set_int(dev, true);
+            }
             return ret;
         }
     }
+    k_msgq_purge(&data->async_msgq);
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_DR_WATCHDOG)
+    k_work_cancel_delayable_sync(&data->dr_watchdog, &sync);
+#endif
+    k_work_cancel_sync(&data->work, &sync);
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_COALESCE)
+    k_work_cancel_delayable_sync(&data->flush_work, &sync);
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ADAPTIVE_SLEEP)
+    k_work_cancel_delayable_sync(&data->sleep_work, &sync);
+#endif
 
-    uint8_t packet[1];
-    ret = pinnacle_seq_read(dev, PINNACLE_SLEEP_INTERVAL, packet, 1);
-
-    if (ret >= 0) {
-        LOG_DBG("Default sleep interval %d", packet[0]);
-    }
+    return 0;
+}
 
-    ret = pinnacle_write(dev, PINNACLE_SLEEP_INTERVAL, 255);
-    if (ret <= 0) {
-        LOG_DBG("Failed to update sleep interaval %d", ret);
+static int pinnacle_pm_suspend(const struct device *dev) {
+    int ret = pinnacle_pm_quiesce(dev);
+    if (ret < 0) {
+        return ret;
     }
 
-    uint8_t feed_cfg2 = PINNACLE_FEED_CFG2_EN_IM | PINNACLE_FEED_CFG2_EN_BTN_SCRL;
-    if (config->no_taps) {
-        feed_cfg2 |= PINNACLE_FEED_CFG2_DIS_TAP;
-    }
+    return pinnacle_set_shutdown(dev, true);
+}
 
-    if (config->no_secondary_tap) {
-        feed_cfg2 |= PINNACLE_FEED_CFG2_DIS_SEC;
-    }
+// Registers are kept through shutdown and still match the shadow, so clearing it is enough
+static int pinnacle_pm_resume(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
 
-    if (config->rotate_90) {
-        feed_cfg2 |= PINNACLE_FEED_CFG2_ROTATE_90;
-    }
-    ret = pinnacle_write(dev, PINNACLE_FEED_CFG2, feed_cfg2);
+    int ret = pinnacle_set_shutdown(dev, false);
     if (ret < 0) {
-        LOG_ERR("can't write %d", ret);
         return ret;
     }
-    uint8_t feed_cfg1 = PINNACLE_FEED_CFG1_EN_FEED;
-    if (config->x_invert) {
-        feed_cfg1 |= PINNACLE_FEED_CFG1_INV_X;
-    }
 
-    if (config->y_invert) {
-        feed_cfg1 |= PINNACLE_FEED_CFG1_INV_Y;
-    }
-    if (feed_cfg1) {
-        ret = pinnacle_write(dev, PINNACLE_FEED_CFG1, feed_cfg1);
-    }
+    // Drop a data ready that was latched before shutdown
+    pinnacle_clear_status(dev);
+
+    data->resume_cycles = k_cycle_get_32();
+    atomic_set_bit(&data->flags, PINNACLE_FLAG_RESUMED);
+    atomic_clear_bit(&data->flags, PINNACLE_FLAG_SUSPENDED);
+
+    return set_int(dev, true);
+}
+
+static int pinnacle_pm_turn_off(const struct device *dev) {
+    struct pinnacle_data *data = dev->data;
+
+    int ret = pinnacle_pm_quiesce(dev);
     if (ret < 0) {
-        LOG_ERR("can't write %d", ret);
         return ret;
     }
 
-    data->dev = dev;
+    // Nothing on the chip survives a power cut; the settings kept in data are reapplied later
+    pinnacle_shadow_invalidate(dev);
+    atomic_clear_bit(&data->flags, PINNACLE_FLAG_READY);
+    k_sem_reset(&data->ready_sem);
 
-    pinnacle_clear_status(dev);
+    return 0;
+}
 
-    gpio_pin_configure_dt(&config->dr, GPIO_INPUT);
-    gpio_init_callback(&data->gpio_cb, pinnacle_gpio_cb, BIT(config->dr.pin));
-    ret = gpio_add_callback(config->dr.port, &data->gpio_cb);
+// Power is back: run bring-up from the runtime state, then stay suspended until RESUME
+static int pinnacle_pm_turn_on(const struct device *dev) {
+    k_msleep(10);
+    int ret = pinnacle_reset(dev);
     if (ret < 0) {
-        LOG_ERR("Failed to set DR callback: %d", ret);
-        return -EIO;
+        return ret;
     }
+    k_msleep(20);
 
-    k_work_init(&data->work, pinnacle_work_cb);
-
-    pinnacle_write(dev, PINNACLE_FEED_CFG1, feed_cfg1);
+    ret = pinnacle_configure(dev);
+    if (ret < 0) {
+        return ret;
+    }
 
-    set_int(dev, true);
+    ret = pinnacle_finish_bringup(dev);
+    if (ret < 0) {
+        return ret;
+    }
 
-    return 0;
+    return pinnacle_pm_suspend(dev);
 }
 
-#if IS_ENABLED(CONFIG_PM_DEVICE)
-
 static int pinnacle_pm_action(const struct device *dev, enum pm_device_action action) {
+    if (action == PM_DEVICE_ACTION_TURN_ON) {
+        return pinnacle_pm_turn_on(dev);
+    }
+
+    if (!pinnacle_is_ready(dev)) {
+        return pinnacle_not_ready(dev);
+    }
+
     switch (action) {
     case PM_DEVICE_ACTION_SUSPEND:
-        return set_int(dev, false);
+        return pinnacle_pm_suspend(dev);
     case PM_DEVICE_ACTION_RESUME:
-        return set_int(dev, true);
+        return pinnacle_pm_resume(dev);
+    case PM_DEVICE_ACTION_TURN_OFF:
+        return pinnacle_pm_turn_off(dev);
     default:
         return -ENOTSUP;
     }
@@ -559,25 +3108,146 @@ static int pinnacle_pm_action(const struct device *dev, enum pm_device_action ac
 
 #endif // IS_ENABLED(CONFIG_PM_DEVICE)
 
+#define PINNACLE_ERA_INIT_ELEM(node_id, prop, idx) DT_PROP_BY_IDX(node_id, prop, idx),
+#define PINNACLE_ACCEL_CURVE_ELEM(node_id, prop, idx) DT_PROP_BY_IDX(node_id, prop, idx),
+// Speeds sit at even indexes; each one past the first must exceed the one before it
+#define PINNACLE_ACCEL_SPEED_RISES(node_id, prop, idx)                                             \
+    &&((idx) % 2 || (idx) < 2 ||                                                                   \
+       DT_PROP_BY_IDX(node_id, prop, idx) > DT_PROP_BY_IDX(node_id, prop, UTIL_DEC(UTIL_DEC(idx))))
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_GESTURES)
+
+#define PINNACLE_TAP_ZONE(n, idx, x0, y0)                                                          \
+    {.x_min = (x0),                                                                                \
+     .y_min = (y0),                                                                                \
+     .x_max = (x0) + DT_INST_PROP(n, tap_zone_size),                                               \
+     .y_max = (y0) + DT_INST_PROP(n, tap_zone_size),                                               \
+     .type = PINNACLE_GESTURE_TAP,                                                                 \
+     .code = DT_INST_PROP_BY_IDX(n, tap_zone_codes, idx)},
+
+// Corner order matches tap-zone-codes: top left, top right, bottom left, bottom right
+#define PINNACLE_TAP_ZONES(n)                                                                      \
+    PINNACLE_TAP_ZONE(n, 0, PINNACLE_ABS_X_MIN, PINNACLE_ABS_Y_MIN)                                \
+    PINNACLE_TAP_ZONE(n, 1, PINNACLE_ABS_X_MAX - DT_INST_PROP(n, tap_zone_size),                   \
+                      PINNACLE_ABS_Y_MIN)                                                          \
+    PINNACLE_TAP_ZONE(n, 2, PINNACLE_ABS_X_MIN,                                                    \
+                      PINNACLE_ABS_Y_MAX - DT_INST_PROP(n, tap_zone_size))                         \
+    PINNACLE_TAP_ZONE(n, 3, PINNACLE_ABS_X_MAX - DT_INST_PROP(n, tap_zone_size),                   \
+                      PINNACLE_ABS_Y_MAX - DT_INST_PROP(n, tap_zone_size))
+
+#define PINNACLE_EDGE_ZONES(n)                                                                     \
+    {.x_min = PINNACLE_ABS_X_MAX - DT_INST_PROP(n, edge_scroll_width),                             \
+     .y_min = PINNACLE_ABS_Y_MIN,                                                                  \
+     .x_max = PINNACLE_ABS_X_MAX,                                                                  \
+     .y_max = PINNACLE_ABS_Y_MAX,                                                                  \
+     .type = PINNACLE_GESTURE_EDGE_V},                                                             \
+        {.x_min = PINNACLE_ABS_X_MIN,                                                              \
+         .y_min = PINNACLE_ABS_Y_MAX - DT_INST_PROP(n, edge_scroll_width),                         \
+         .x_max = PINNACLE_ABS_X_MAX,                                                              \
+         .y_max = PINNACLE_ABS_Y_MAX,                                                              \
+         .type = PINNACLE_GESTURE_EDGE_H},
+
+#define PINNACLE_HAS_GESTURE_ZONES(n)                                                              \
+    UTIL_OR(DT_INST_NODE_HAS_PROP(n, tap_zone_codes), DT_INST_NODE_HAS_PROP(n, edge_scroll_width))
+
+// Tap zones come first so a corner wins over the edge strip running through it
+#define PINNACLE_GESTURE_ZONES_DEFINE(n)                                                           \
+    BUILD_ASSERT(DT_INST_PROP_LEN_OR(n, tap_zone_codes, 4) == 4,                                   \
+                 "tap-zone-codes must have one entry per corner");                                 \
+    BUILD_ASSERT(DT_INST_PROP(n, circular_scroll_ring) < 100,                                      \
+                 "circular-scroll-ring must be below 100");                                        \
+    BUILD_ASSERT(DT_INST_PROP(n, circular_scroll_step) > 0 &&                                      \
+                     DT_INST_PROP(n, edge_scroll_step) > 0,                                        \
+                 "scroll steps must be at least 1");                                               \
+    IF_ENABLED(PINNACLE_HAS_GESTURE_ZONES(n),                                                      \
+               (static const struct pinnacle_gesture_zone pinnacle_gesture_zones_##n[] = {         \
+                    IF_ENABLED(DT_INST_NODE_HAS_PROP(n, tap_zone_codes), (PINNACLE_TAP_ZONES(n)))  \
+                        IF_ENABLED(DT_INST_NODE_HAS_PROP(n, edge_scroll_width),                    \
+                                   (PINNACLE_EDGE_ZONES(n)))};))
+
+#define PINNACLE_GESTURE_CONFIG(n)                                                                 \
+    .gestures = {                                                                                  \
+        IF_ENABLED(PINNACLE_HAS_GESTURE_ZONES(n),                                                  \
+                   (.zones = pinnacle_gesture_zones_##n,                                           \
+                    .zone_count = ARRAY_SIZE(pinnacle_gesture_zones_##n), ))                       \
+            .circular_scroll = DT_INST_PROP(n, circular_scroll),                                   \
+        .circular_ring_pct = DT_INST_PROP(n, circular_scroll_ring),                                \
+        .circular_step = DT_INST_PROP(n, circular_scroll_step),                                    \
+        .edge_step = DT_INST_PROP(n, edge_scroll_step),                                            \
+    },
+
+#else
+
+#define PINNACLE_GESTURE_ZONES_DEFINE(n)
+#define PINNACLE_GESTURE_CONFIG(n)
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_GESTURES)
+
 #define PINNACLE_INST(n)                                                                           \
+    BUILD_ASSERT(DT_INST_PROP(n, scroll_divisor) > 0, "scroll-divisor must be at least 1");        \
+    BUILD_ASSERT(DT_INST_NODE_HAS_PROP(n, dr_gpios) || IS_ENABLED(CONFIG_INPUT_PINNACLE_POLL),     \
+                 "Without dr-gpios, CONFIG_INPUT_PINNACLE_POLL is required");                      \
+    BUILD_ASSERT(DT_INST_PROP(n, abs_delta_divisor) > 0, "abs-delta-divisor must be at least 1");  \
+    BUILD_ASSERT(DT_INST_PROP(n, idle_sample_packets) > 0,                                         \
+                 "idle-sample-packets must be at least 1");                                        \
+    BUILD_ASSERT(DT_INST_PROP_LEN_OR(n, era_writes, 0) % 2 == 0,                                   \
+                 "era-writes must be <address value> pairs");                                      \
+    IF_ENABLED(DT_INST_NODE_HAS_PROP(n, era_writes),                                               \
+               (static const uint16_t pinnacle_era_init_##n[] = {                                  \
+                    DT_INST_FOREACH_PROP_ELEM(n, era_writes, PINNACLE_ERA_INIT_ELEM)};))           \
+    BUILD_ASSERT(DT_INST_PROP_LEN_OR(n, accel_curve, 0) % 2 == 0,                                  \
+                 "accel-curve must be <speed gain> pairs");                                        \
+    IF_ENABLED(DT_INST_NODE_HAS_PROP(n, accel_curve),                                              \
+               (BUILD_ASSERT(1 DT_INST_FOREACH_PROP_ELEM(n, accel_curve,                           \
+                                                         PINNACLE_ACCEL_SPEED_RISES),              \
+                             "accel-curve speeds must be strictly increasing");                    \
+                static const uint16_t pinnacle_accel_curve_##n[] = {                               \
+                    DT_INST_FOREACH_PROP_ELEM(n, accel_curve, PINNACLE_ACCEL_CURVE_ELEM)};))       \
+    PINNACLE_GESTURE_ZONES_DEFINE(n)                                                               \
+    IF_ENABLED(DT_INST_ON_BUS(n, spi), (static struct pinnacle_spi_bufs pinnacle_spi_bufs_##n;))   \
     static struct pinnacle_data pinnacle_data_##n;                                                 \
     static const struct pinnacle_config pinnacle_config_##n = {                                    \
         COND_CODE_1(DT_INST_ON_BUS(n, i2c),                                                        \
-                    (.bus = {.i2c = I2C_DT_SPEC_INST_GET(n)}, .seq_read = pinnacle_i2c_seq_read,   \
-                     .write = pinnacle_i2c_write),                                                 \
+                    (.bus = {.i2c = I2C_DT_SPEC_INST_GET(n)} PINNACLE_I2C_OPS),                    \
                     (.bus = {.spi = SPI_DT_SPEC_INST_GET(n,                                        \
                                                          SPI_OP_MODE_MASTER | SPI_WORD_SET(8) |    \
                                                              SPI_TRANSFER_MSB | SPI_MODE_CPHA,     \
                                                          0)},                                      \
-                     .seq_read = pinnacle_spi_seq_read, .write = pinnacle_spi_write)),             \
+                     .spi_bufs = &pinnacle_spi_bufs_##n PINNACLE_SPI_OPS)),                        \
         .rotate_90 = DT_INST_PROP(n, rotate_90),                                                   \
         .x_invert = DT_INST_PROP(n, x_invert),                                                     \
         .y_invert = DT_INST_PROP(n, y_invert),                                                     \
         .sleep_en = DT_INST_PROP(n, sleep),                                                        \
         .no_taps = DT_INST_PROP(n, no_taps),                                                       \
         .no_secondary_tap = DT_INST_PROP(n, no_secondary_tap),                                     \
+        .burst_read = DT_INST_PROP(n, burst_read),                                                 \
+        .scroll_invert = DT_INST_PROP(n, scroll_invert),                                           \
+        .scroll_horizontal = DT_INST_PROP(n, scroll_horizontal),                                   \
+        .scroll_divisor = DT_INST_PROP(n, scroll_divisor),                                         \
+        .absolute = DT_INST_PROP(n, absolute_mode),                                                \
+        .report_absolute = DT_INST_PROP(n, report_absolute),                                       \
+        .packet_len = DT_INST_PROP(n, absolute_mode) ? PINNACLE_ABS_PACKET_LEN                     \
+                                                     : PINNACLE_REL_PACKET_LEN,                    \
+        .abs_z_threshold = DT_INST_PROP(n, abs_z_threshold),                                       \
+        .abs_delta_divisor = DT_INST_PROP(n, abs_delta_divisor),                                   \
+        .sample_rate = DT_INST_PROP(n, sample_rate),                                               \
+        .idle_sample_rate = DT_INST_PROP_OR(n, idle_sample_rate, 0),                               \
+        .idle_sample_packets = DT_INST_PROP(n, idle_sample_packets),                               \
+        IF_ENABLED(DT_INST_NODE_HAS_PROP(n, era_writes),                                           \
+                   (.era_init = pinnacle_era_init_##n,                                             \
+                    .era_init_len = ARRAY_SIZE(pinnacle_era_init_##n), ))                          \
         .x_axis_z_min = DT_INST_PROP_OR(n, x_axis_z_min, 5),                                       \
+        .sleep_interval = DT_INST_PROP(n, sleep_interval),                                         \
+        .sleep_interval_active = DT_INST_PROP_OR(n, sleep_interval_active, 0),                     \
+        .sleep_timer = DT_INST_PROP_OR(n, sleep_timer, -1),                                        \
+        .poll_interval_ms = DT_INST_PROP(n, poll_interval_ms),                                     \
+        .poll_idle_interval_ms = DT_INST_PROP(n, poll_idle_interval_ms),                           \
+        .poll_idle_after_ms = DT_INST_PROP(n, poll_idle_after_ms),                                 \
         .y_axis_z_min = DT_INST_PROP_OR(n, y_axis_z_min, 4),                                       \
+        IF_ENABLED(DT_INST_NODE_HAS_PROP(n, accel_curve),                                          \
+                   (.accel_curve = pinnacle_accel_curve_##n,                                       \
+                    .accel_curve_len = ARRAY_SIZE(pinnacle_accel_curve_##n), ))                    \
+        PINNACLE_GESTURE_CONFIG(n)                                                                 \
         .sensitivity = DT_INST_ENUM_IDX_OR(n, sensitivity, PINNACLE_SENSITIVITY_1X),               \
         .dr = GPIO_DT_SPEC_GET_OR(DT_DRV_INST(n), dr_gpios, {}),                                   \
     };                                                                                             \
@@ -587,3 +3257,124 @@ static int pinnacle_pm_action(const struct device *dev, enum pm_device_action ac
                           NULL);
 
 DT_INST_FOREACH_STATUS_OKAY(PINNACLE_INST)
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_STATS_SHELL) || IS_ENABLED(CONFIG_INPUT_PINNACLE_TRACE_SHELL)
+
+#define PINNACLE_DEV_ENTRY(n) DEVICE_DT_INST_GET(n),
+
+static const struct device *const pinnacle_devs[] = {
+    DT_INST_FOREACH_STATUS_OKAY(PINNACLE_DEV_ENTRY)};
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_STATS_SHELL)
+
+static void pinnacle_shell_hist(const struct shell *sh, const char *name,
+                                const struct pinnacle_hist *hist) {
+    shell_print(sh, "  %s", name);
+    for (size_t i = 0; i < PINNACLE_HIST_BUCKETS; i++) {
+        uint32_t lo = i == 0 ? 0 : BIT(PINNACLE_HIST_SHIFT - 1) << i;
+        uint32_t hi = (BIT(PINNACLE_HIST_SHIFT) << i) - 1;
+
+        if (i == PINNACLE_HIST_BUCKETS - 1) {
+            shell_print(sh, "    %5u+       us: %u", lo, hist->buckets[i]);
+        } else {
+            shell_print(sh, "    %5u-%-5u us: %u", lo, hi, hist->buckets[i]);
+        }
+    }
+}
+
+static int cmd_pinnacle_stats(const struct shell *sh, size_t argc, char **argv) {
+    bool reset = argc > 1 && strcmp(argv[1], "reset") == 0;
+
+    if (argc > 1 && !reset) {
+        shell_error(sh, "Unknown argument: %s", argv[1]);
+        return -EINVAL;
+    }
+
+    for (size_t i = 0; i < ARRAY_SIZE(pinnacle_devs); i++) {
+        const struct device *dev = pinnacle_devs[i];
+        struct pinnacle_data *data = dev->data;
+        struct pinnacle_hist dr_to_report, bus_xfer;
+        STATS_SECT_DECL(pinnacle) stats;
+
+        // Printed from a snapshot, so a reset never loses updates made while printing
+        k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+        stats = data->stats;
+        dr_to_report = data->dr_to_report;
+        bus_xfer = data->bus_xfer;
+        if (reset) {
+            stats_reset(&data->stats.s_hdr);
+            memset(&data->dr_to_report, 0, sizeof(data->dr_to_report));
+            memset(&data->bus_xfer, 0, sizeof(data->bus_xfer));
+        }
+        k_spin_unlock(&data->stats_lock, key);
+
+        shell_print(sh, "%s", dev->name);
+        shell_print(sh, "  interrupts %u, reports %u, comm failures %u, spurious %u",
+                    stats.interrupts, stats.reports, stats.comm_failures, stats.spurious);
+        shell_print(sh, "  bus errors %u, ERA wait loops %u", stats.bus_errors,
+                    stats.era_wait_loops);
+        pinnacle_shell_hist(sh, "DR to report", &dr_to_report);
+        pinnacle_shell_hist(sh, "bus transfer", &bus_xfer);
+    }
+
+    return 0;
+}
+
+#define PINNACLE_SHELL_STATS_CMD                                                                   \
+    SHELL_CMD_ARG(stats, NULL,                                                                     \
+                  "Show counters and latency histograms, optionally clearing them: stats [reset]", \
+                  cmd_pinnacle_stats, 1, 1),
+#else
+#define PINNACLE_SHELL_STATS_CMD
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_STATS_SHELL)
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_TRACE_SHELL)
+
+// One line of hex per record, in the PINNACLE_TRACE_RECORD_LEN byte dump format
+static int cmd_pinnacle_trace(const struct shell *sh, size_t argc, char **argv) {
+    bool clear = argc > 1 && strcmp(argv[1], "clear") == 0;
+
+    if (argc > 1 && !clear) {
+        shell_error(sh, "Unknown argument: %s", argv[1]);
+        return -EINVAL;
+    }
+
+    for (size_t i = 0; i < ARRAY_SIZE(pinnacle_devs); i++) {
+        const struct device *dev = pinnacle_devs[i];
+        struct pinnacle_data *data = dev->data;
+        struct pinnacle_trace_entry entry;
+        uint8_t record[PINNACLE_TRACE_RECORD_LEN];
+        char hex[PINNACLE_TRACE_RECORD_LEN * 2 + 1];
+        uint32_t head;
+        uint32_t first = pinnacle_trace_first(data, &head);
+
+        shell_print(sh, "%s: %u records", dev->name, head - first);
+        for (uint32_t j = first; j != head; j++) {
+            pinnacle_trace_get(data, j, &entry);
+            pinnacle_trace_encode(&entry, record);
+            bin2hex(record, sizeof(record), hex, sizeof(hex));
+            shell_print(sh, "%s", hex);
+        }
+
+        if (clear) {
+            pinnacle_trace_clear(dev);
+        }
+    }
+
+    return 0;
+}
+
+#define PINNACLE_SHELL_TRACE_CMD                                                                   \
+    SHELL_CMD_ARG(trace, NULL, "Dump the raw packet trace, optionally clearing it: trace [clear]", \
+                  cmd_pinnacle_trace, 1, 1),
+#else
+#define PINNACLE_SHELL_TRACE_CMD
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_TRACE_SHELL)
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_pinnacle, PINNACLE_SHELL_STATS_CMD PINNACLE_SHELL_TRACE_CMD
+                                                 SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(pinnacle, &sub_pinnacle, "Cirque Pinnacle trackpad commands", NULL);
+
+#endif // CONFIG_INPUT_PINNACLE_STATS_SHELL || CONFIG_INPUT_PINNACLE_TRACE_SHELL
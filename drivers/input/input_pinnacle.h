@@ -3,6 +3,9 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/i2c.h>
 #include <zephyr/drivers/spi.h>
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_STATS)
+#include <zephyr/stats/stats.h>
+#endif
 
 #define PINNACLE_READ 0xA0
 #define PINNACLE_WRITE 0x80
@@ -49,6 +52,15 @@
 #define PINNACLE_2_2_PACKET0 0x12    // trackpad Data
 #define PINNACLE_REG_COUNT 0x18
 
+// Relative packet with the Intellimouse wheel byte
+#define PINNACLE_REL_PACKET_LEN 4
+#define PINNACLE_ABS_PACKET_LEN 6
+#define PINNACLE_PACKET_MAX_LEN PINNACLE_ABS_PACKET_LEN
+
+// STATUS1 through the last packet byte, fetched in a single auto-increment read
+#define PINNACLE_BURST_LEN(packet_len) (PINNACLE_2_2_PACKET0 + (packet_len) - PINNACLE_STATUS1)
+#define PINNACLE_BURST_MAX_LEN PINNACLE_BURST_LEN(PINNACLE_PACKET_MAX_LEN)
+
 #define PINNACLE_REG_ERA_VALUE 0x1B
 #define PINNACLE_REG_ERA_HIGH_BYTE 0x1C
 #define PINNACLE_REG_ERA_LOW_BYTE 0x1D
@@ -56,6 +68,10 @@
 
 #define PINNACLE_ERA_CONTROL_READ 0x01
 #define PINNACLE_ERA_CONTROL_WRITE 0x02
+#define PINNACLE_ERA_CONTROL_AUTO_INC 0x04
+
+// Longest run of consecutive ERA addresses merged into one auto-increment write
+#define PINNACLE_ERA_RUN_MAX 16
 
 #define PINNACLE_ERA_REG_X_AXIS_WIDE_Z_MIN 0x0149
 #define PINNACLE_ERA_REG_Y_AXIS_WIDE_Z_MIN 0x0168
@@ -72,38 +88,507 @@
 #define PINNACLE_PACKET0_X_SIGN BIT(4)   // X delta sign
 #define PINNACLE_PACKET0_Y_SIGN BIT(5)   // Y delta sign
 
+// Absolute mode coordinate limits, outside of which the sensor doesn't report reliably
+#define PINNACLE_ABS_X_MIN 127
+#define PINNACLE_ABS_X_MAX 1919
+#define PINNACLE_ABS_Y_MIN 63
+#define PINNACLE_ABS_Y_MAX 1471
+#define PINNACLE_ABS_Z_MASK 0x3F
+
+// Command byte plus two filler bytes ahead of the data on SPI reads
+#define PINNACLE_SPI_XFER_MAX (PINNACLE_BURST_MAX_LEN + 3)
+
+// Transfer buffers are cache line aligned and padded so DMA capable controllers can use them as is
+#if defined(CONFIG_DCACHE_LINE_SIZE) && CONFIG_DCACHE_LINE_SIZE > 0
+#define PINNACLE_SPI_BUF_ALIGN CONFIG_DCACHE_LINE_SIZE
+#else
+#define PINNACLE_SPI_BUF_ALIGN 4
+#endif
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+
+#define PINNACLE_ASYNC_QUEUE_LEN 4
+
+enum pinnacle_async_state {
+    PINNACLE_ASYNC_IDLE,
+    PINNACLE_ASYNC_READ_STATUS,
+    PINNACLE_ASYNC_READ_PACKET,
+    PINNACLE_ASYNC_CLEAR_STATUS,
+};
+
+enum pinnacle_async_flag {
+    PINNACLE_ASYNC_BUSY,
+    PINNACLE_ASYNC_PENDING,
+    PINNACLE_ASYNC_FALLBACK,
+};
+
+struct pinnacle_spi_async_xfer {
+    struct spi_buf tx_buf;
+    struct spi_buf rx_buf[2];
+    struct spi_buf_set tx;
+    struct spi_buf_set rx;
+};
+
+// Callback transfer buffers, aligned and padded like struct pinnacle_spi_bufs
+struct pinnacle_async_bufs {
+    uint8_t regs[ROUND_UP(PINNACLE_BURST_MAX_LEN, PINNACLE_SPI_BUF_ALIGN)]
+        __aligned(PINNACLE_SPI_BUF_ALIGN);
+    uint8_t tx[ROUND_UP(PINNACLE_SPI_XFER_MAX, PINNACLE_SPI_BUF_ALIGN)]
+        __aligned(PINNACLE_SPI_BUF_ALIGN);
+    // Bytes clocked in during the command and filler bytes
+    uint8_t rx[ROUND_UP(3, PINNACLE_SPI_BUF_ALIGN)] __aligned(PINNACLE_SPI_BUF_ALIGN);
+};
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+
+// Writable configuration registers mirrored in pinnacle_data, SYS_CFG through SLEEP_TIMER
+#define PINNACLE_SHADOW_FIRST PINNACLE_SYS_CFG
+#define PINNACLE_SHADOW_LAST PINNACLE_SLEEP_TIMER
+#define PINNACLE_SHADOW_LEN (PINNACLE_SHADOW_LAST - PINNACLE_SHADOW_FIRST + 1)
+// Valid bit for the ERA ADC tracking byte, after the register bits
+#define PINNACLE_SHADOW_ADC_BIT PINNACLE_SHADOW_LEN
+
+struct pinnacle_shadow_stats {
+    uint32_t avoided; // register and ERA accesses skipped thanks to the shadow copy
+    uint32_t resyncs; // shadow reloads from the chip
+};
+
+struct pinnacle_shadow {
+    uint8_t regs[PINNACLE_SHADOW_LEN];
+    uint8_t adc_config;
+    atomic_t valid; // one bit per regs entry, plus PINNACLE_SHADOW_ADC_BIT
+    struct pinnacle_shadow_stats stats;
+};
+
+// Motion is accumulated in 1/256 counts so fractional deltas from scaling carry over
+#define PINNACLE_SUBCOUNT_SCALE 256
+
+struct pinnacle_coalesce_stats {
+    uint32_t packets; // packets merged into the accumulator
+    uint32_t reports; // motion reports emitted
+};
+
+enum pinnacle_flag {
+    PINNACLE_FLAG_WAITING,
+    PINNACLE_FLAG_READY,
+    PINNACLE_FLAG_RESUMED,
+    PINNACLE_FLAG_POLLING,
+    PINNACLE_FLAG_FAILED,
+    PINNACLE_FLAG_DR_STAMPED,     // dr_cycles holds an edge no latency sample was taken for yet
+    PINNACLE_FLAG_SUSPENDED,      // PM suspended or off: work items must not touch the bus
+    PINNACLE_FLAG_SETTINGS_DIRTY, // settings changed during bring-up, rewritten before ready
+    PINNACLE_FLAG_REPORT_STAMPED, // dr_cycles holds an edge no dr_to_report sample was taken for
+    PINNACLE_FLAG_REPLAYING,      // a trace replay is decoding: motion is flushed per packet
+};
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_GESTURES)
+
+enum pinnacle_gesture_type {
+    PINNACLE_GESTURE_NONE,
+    PINNACLE_GESTURE_TAP,
+    PINNACLE_GESTURE_EDGE_V,
+    PINNACLE_GESTURE_EDGE_H,
+    PINNACLE_GESTURE_CIRCULAR,
+};
+
+// Rectangle in absolute coordinates; a touch starting inside it runs the zone's gesture
+struct pinnacle_gesture_zone {
+    uint16_t x_min, y_min, x_max, y_max;
+    enum pinnacle_gesture_type type;
+    uint16_t code; // key code for tap zones
+};
+
+struct pinnacle_gesture_config {
+    const struct pinnacle_gesture_zone *zones;
+    size_t zone_count;
+    bool circular_scroll;
+    uint8_t circular_ring_pct;
+    uint16_t circular_step; // 1/1024 turns per wheel step
+    uint16_t edge_step;     // absolute counts per wheel step
+};
+
+struct pinnacle_gesture_data {
+    enum pinnacle_gesture_type active;
+    bool touching;
+    uint16_t code;
+    int32_t angle, acc, travel;
+    uint32_t start_ms;
+};
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_GESTURES)
+
+struct pinnacle_latency_stats {
+    uint32_t last_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint32_t count;
+};
+
+// Bucket 0 is below 64 us, bucket i covers [32 << i, 64 << i) us and the last one is open ended
+#define PINNACLE_HIST_BUCKETS 8
+#define PINNACLE_HIST_SHIFT 6
+
+struct pinnacle_hist {
+    uint32_t buckets[PINNACLE_HIST_BUCKETS];
+};
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_STATS)
+STATS_SECT_START(pinnacle)
+STATS_SECT_ENTRY32(interrupts)
+STATS_SECT_ENTRY32(reports)
+STATS_SECT_ENTRY32(comm_failures) // STATUS1 read back as 0xFF
+STATS_SECT_ENTRY32(spurious)      // woken up without SW_DR set
+STATS_SECT_ENTRY32(bus_errors)
+STATS_SECT_ENTRY32(era_wait_loops)
+STATS_SECT_END;
+#endif
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_TRACE)
+struct pinnacle_trace_entry {
+    uint32_t time_us;
+    uint8_t seq;    // low byte of the capture index, a gap means entries were overwritten
+    uint8_t status; // STATUS1 as read, including 0xFF failures and reads without SW_DR
+    uint8_t packet[PINNACLE_PACKET_MAX_LEN]; // zero when no packet was read
+};
+
+// Dump record: time_us as little endian u32, seq, status, then the packet bytes
+#define PINNACLE_TRACE_RECORD_LEN (6 + PINNACLE_PACKET_MAX_LEN)
+#endif
+
+struct pinnacle_dr_stats {
+    uint32_t drained;    // packets read by the drain loop without a DR edge of their own
+    uint32_t recoveries; // stuck DR resynchronizations by the watchdog
+};
+
+// PM resume to the first packet processed afterwards
+struct pinnacle_pm_stats {
+    uint32_t last_resume_us;
+    uint32_t max_resume_us;
+    uint32_t resumes;
+};
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_CAL_CACHE)
+
+#if !defined(CONFIG_INPUT_PINNACLE_CAL_CACHE_ERA_ADDR) ||                                          \
+    !defined(CONFIG_INPUT_PINNACLE_CAL_CACHE_LEN)
+#error "Set CONFIG_INPUT_PINNACLE_CAL_CACHE_ERA_ADDR and _LEN to your firmware's compensation data"
+#endif
+
+// Saved under PINNACLE_CAL_SETTINGS_ROOT "/" and the device name
+#define PINNACLE_CAL_SETTINGS_ROOT "pinnacle_cal"
+
+// Compensation data saved after a good calibration, tied to the chip and ADC setup it came from
+struct pinnacle_cal_blob {
+    uint8_t fw_id[2];
+    uint8_t sensitivity;
+    uint8_t comp[CONFIG_INPUT_PINNACLE_CAL_CACHE_LEN];
+    uint32_t crc;
+};
+
+#endif // IS_ENABLED(CONFIG_INPUT_PINNACLE_CAL_CACHE)
+
+enum pinnacle_sensitivity {
+    PINNACLE_SENSITIVITY_1X,
+    PINNACLE_SENSITIVITY_2X,
+    PINNACLE_SENSITIVITY_3X,
+    PINNACLE_SENSITIVITY_4X,
+};
+
+// Settings that can be changed at runtime, starting out with the devicetree values
+struct pinnacle_settings {
+    enum pinnacle_sensitivity sensitivity;
+    bool x_invert, y_invert, rotate_90;
+    bool no_taps, no_secondary_tap;
+    uint8_t x_axis_z_min, y_axis_z_min;
+};
+
+typedef int (*pinnacle_sync_fn_t)(const struct device *dev, const void *arg);
+
 struct pinnacle_data {
+    uint8_t fw_id[2]; // FW ID and version read at init, zero if the read failed
     uint8_t btn_cache;
     bool in_int;
     const struct device *dev;
     struct gpio_callback gpio_cb;
     struct k_work work;
+    atomic_t flags;
+    int32_t acc_x, acc_y, acc_wheel;
+    uint8_t sample_rate, cur_sample_rate;
+    uint8_t idle_packets;
+    uint16_t abs_x, abs_y;
+    bool abs_touch;
+    /*
+     * Guards the register shadow, whose read-modify-writes come from the driver work queue, the
+     * system work queue and API callers, and the settings. Recursive, so helpers take it again
+     * freely.
+     */
+    struct k_mutex lock;
+    struct pinnacle_shadow shadow;
+    struct pinnacle_settings settings;
+    // Latest pinnacle_set_settings_async() request, valid while pending_seq != applied_seq.
+    // settings_lock covers these three only; settings itself is under lock.
+    struct pinnacle_settings pending_settings;
+    uint32_t pending_seq, applied_seq;
+    struct k_spinlock settings_lock;
+    struct k_work settings_work;
+    // Blocking API calls, e.g. recalibration or settings changes, run on the work queue
+    struct k_work_delayable sync_work;
+    struct k_sem sync_done;
+    struct k_mutex sync_lock;
+    pinnacle_sync_fn_t sync_fn;
+    const void *sync_arg;
+    int sync_result;
+    uint32_t packets;
+    // Guards the stats structs and histograms, updated from the work queue and the DR ISR
+    struct k_spinlock stats_lock;
+    struct pinnacle_dr_stats dr_stats;
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_POLL)
+    struct k_timer poll_timer;
+    bool poll_slow;
+    uint32_t poll_packets;
+    uint32_t poll_active_ms;
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_DR_WATCHDOG)
+    struct k_work_delayable dr_watchdog;
+    uint32_t watchdog_packets;
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_SETTINGS)
+    struct k_work_delayable save_work;
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ADAPTIVE_SLEEP)
+    struct k_work_delayable sleep_work;
+    uint8_t sleep_interval;
+    uint32_t sleep_active_ms;
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_GESTURES)
+    struct pinnacle_gesture_data gesture;
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_COALESCE)
+    struct k_work_delayable flush_work;
+    struct pinnacle_coalesce_stats coalesce;
+#endif
+    struct k_sem ready_sem;
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_DEFERRED_INIT)
+    struct k_work_delayable init_work;
+    uint8_t init_step;
+    uint8_t init_retries;
+    uint32_t init_start_ms;
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_WAIT_ON_DR)
+    struct k_sem cc_sem;
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+    // Transfer state must outlive the call that starts it, so it lives here rather than on stack
+    enum pinnacle_async_state async_state;
+    atomic_t async_flags;
+    // Chain steps run from this work item, never from the DR ISR or the bus callback
+    struct k_work async_work;
+    int async_result;
+    struct pinnacle_async_bufs async_bufs;
+    union {
+        struct i2c_msg i2c[2];
+        struct pinnacle_spi_async_xfer spi;
+    } async_xfer;
+    struct k_msgq async_msgq;
+    char async_msgq_buf[PINNACLE_ASYNC_QUEUE_LEN * PINNACLE_PACKET_MAX_LEN];
+#endif
+#if IS_ENABLED(CONFIG_PM_DEVICE)
+    uint32_t resume_cycles;
+    struct pinnacle_pm_stats pm;
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_LATENCY_TRACKING) || IS_ENABLED(CONFIG_INPUT_PINNACLE_STATS)
+    uint32_t dr_cycles;
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_LATENCY_TRACKING)
+    struct pinnacle_latency_stats latency;
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_STATS)
+    STATS_SECT_DECL(pinnacle) stats;
+    struct pinnacle_hist dr_to_report;
+    struct pinnacle_hist bus_xfer;
+#endif
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_TRACE)
+    // Guards the ring and its head: captures come from the work queue, reads from any thread
+    struct k_spinlock trace_lock;
+    uint32_t trace_head;
+    struct pinnacle_trace_entry trace[CONFIG_INPUT_PINNACLE_TRACE_LEN];
+#endif
 };
 
-enum pinnacle_sensitivity {
-    PINNACLE_SENSITIVITY_1X,
-    PINNACLE_SENSITIVITY_2X,
-    PINNACLE_SENSITIVITY_3X,
-    PINNACLE_SENSITIVITY_4X,
+/*
+ * When every instance sits on the same bus type the bus ops are called directly and the config
+ * carries neither function pointers nor the other bus's spec. Runtime dispatch is only kept for
+ * builds that mix I2C and SPI instances.
+ */
+#define PINNACLE_BUS_I2C DT_COMPAT_ON_BUS_STATUS_OKAY(cirque_pinnacle, i2c)
+#define PINNACLE_BUS_SPI DT_COMPAT_ON_BUS_STATUS_OKAY(cirque_pinnacle, spi)
+#define PINNACLE_BUS_MIXED (PINNACLE_BUS_I2C && PINNACLE_BUS_SPI)
+
+struct pinnacle_spi_bufs {
+    struct k_mutex lock;
+    uint8_t tx[ROUND_UP(PINNACLE_SPI_XFER_MAX, PINNACLE_SPI_BUF_ALIGN)]
+        __aligned(PINNACLE_SPI_BUF_ALIGN);
+    uint8_t rx[ROUND_UP(PINNACLE_SPI_XFER_MAX, PINNACLE_SPI_BUF_ALIGN)]
+        __aligned(PINNACLE_SPI_BUF_ALIGN);
 };
 
+struct pinnacle_reg_write {
+    uint8_t addr;
+    uint8_t val;
+};
+
+// Longest chain of register writes handed to write_seq in one go
+#define PINNACLE_WRITE_SEQ_MAX 4
+
 typedef int (*pinnacle_seq_read_t)(const struct device *dev, const uint8_t addr, uint8_t *buf,
                                    const uint8_t len);
 typedef int (*pinnacle_write_t)(const struct device *dev, const uint8_t addr, const uint8_t val);
+typedef int (*pinnacle_write_seq_t)(const struct device *dev,
+                                    const struct pinnacle_reg_write *writes, const size_t count);
+typedef int (*pinnacle_async_read_t)(const struct device *dev, const uint8_t addr,
+                                     const uint8_t len);
 
 struct pinnacle_config {
     union {
+#if PINNACLE_BUS_I2C || !PINNACLE_BUS_SPI
         struct i2c_dt_spec i2c;
+#endif
+#if PINNACLE_BUS_SPI
         struct spi_dt_spec spi;
+#endif
     } bus;
 
+#if PINNACLE_BUS_MIXED
     pinnacle_seq_read_t seq_read;
     pinnacle_write_t write;
+    pinnacle_write_seq_t write_seq;
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+    pinnacle_async_read_t async_read;
+    pinnacle_write_t async_write;
+#endif
+#endif
+#if PINNACLE_BUS_SPI
+    struct pinnacle_spi_bufs *spi_bufs; // NULL on I2C
+#endif
 
-    bool rotate_90, sleep_en, no_taps, no_secondary_tap, x_invert, y_invert;
+    bool rotate_90, sleep_en, no_taps, no_secondary_tap, x_invert, y_invert, burst_read;
+    bool scroll_invert, scroll_horizontal;
+    bool absolute, report_absolute;
+    uint8_t packet_len, abs_z_threshold, abs_delta_divisor;
+    uint8_t scroll_divisor;
     enum pinnacle_sensitivity sensitivity;
     uint8_t x_axis_z_min, y_axis_z_min;
-    const struct gpio_dt_spec dr;
+    uint8_t sleep_interval, sleep_interval_active;
+    int16_t sleep_timer; // -1 keeps the chip default
+    uint16_t poll_interval_ms, poll_idle_interval_ms, poll_idle_after_ms;
+    uint8_t sample_rate, idle_sample_rate, idle_sample_packets;
+    // Flat <address value> pairs written to ERA at init, after the Z-min values
+    const uint16_t *era_init;
+    size_t era_init_len;
+    // Flat <speed gain> pairs, gain in 1/PINNACLE_SUBCOUNT_SCALE units
+    const uint16_t *accel_curve;
+    size_t accel_curve_len;
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_GESTURES)
+    struct pinnacle_gesture_config gestures;
+#endif
+    const struct gpio_dt_spec dr; // port is NULL without dr-gpios, the pad is polled instead
 };
 
 int pinnacle_set_sleep(const struct device *dev, bool enabled);
+
+/*
+ * Sets the full (active) sample rate: 10, 20, 40, 60, 80, 100 or 200 samples per second. The
+ * write runs on the driver's work queue, between packets, and the call blocks until it is done.
+ */
+int pinnacle_set_sample_rate(const struct device *dev, uint8_t rate);
+
+int pinnacle_get_coalesce_stats(const struct device *dev, struct pinnacle_coalesce_stats *stats);
+
+int pinnacle_get_settings(const struct device *dev, struct pinnacle_settings *settings);
+
+/*
+ * Applies new settings live, writing only the registers and ERA bytes that change. The writes
+ * run on the driver's work queue, between packets, and the call blocks until they are done. On
+ * failure the previous settings are kept. With CONFIG_INPUT_PINNACLE_SETTINGS the result is
+ * saved and restored at boot.
+ */
+int pinnacle_set_settings(const struct device *dev, const struct pinnacle_settings *settings);
+
+/*
+ * Same as pinnacle_set_settings(), but applied from the driver's work queue so the caller never
+ * waits on ERA access; failures are only logged. Until the change is applied,
+ * pinnacle_get_settings() returns the requested settings, so read-modify-write callers compose.
+ */
+int pinnacle_set_settings_async(const struct device *dev,
+                                const struct pinnacle_settings *settings);
+
+/*
+ * Runs a full forced calibration, replacing the saved result with CONFIG_INPUT_PINNACLE_CAL_CACHE.
+ * The calibration runs on the driver's work queue, between packets, and the call blocks until it
+ * is done.
+ */
+int pinnacle_recalibrate(const struct device *dev);
+
+int pinnacle_get_shadow_stats(const struct device *dev, struct pinnacle_shadow_stats *stats);
+
+// Reloads the register shadow from the chip, e.g. after it was reset behind the driver's back
+int pinnacle_resync(const struct device *dev);
+
+/*
+ * With CONFIG_INPUT_PINNACLE_DEFERRED_INIT the device finishes bring-up after boot continues, and
+ * device_is_ready() is already true while the chip is still unconfigured. Consumers must gate on
+ * pinnacle_is_ready() or pinnacle_wait_ready() instead. pinnacle_wait_ready() returns -EIO, and
+ * configuration calls fail with -EIO rather than -EAGAIN, once bring-up has given up.
+ */
+bool pinnacle_is_ready(const struct device *dev);
+int pinnacle_wait_ready(const struct device *dev, k_timeout_t timeout);
+
+// DR edge to work item start latency, optionally clearing the counters after reading them
+int pinnacle_get_latency_stats(const struct device *dev, struct pinnacle_latency_stats *stats,
+                               bool reset);
+
+int pinnacle_get_dr_stats(const struct device *dev, struct pinnacle_dr_stats *stats);
+
+int pinnacle_get_pm_stats(const struct device *dev, struct pinnacle_pm_stats *stats);
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_TRACE)
+// Copies up to max of the most recent entries, oldest first; returns how many were copied
+size_t pinnacle_trace_read(const struct device *dev, struct pinnacle_trace_entry *out, size_t max);
+void pinnacle_trace_clear(const struct device *dev);
+// Logs every entry still in the ring as one PINNACLE_TRACE_RECORD_LEN byte hex dump
+void pinnacle_trace_log(const struct device *dev);
+void pinnacle_trace_encode(const struct pinnacle_trace_entry *entry, uint8_t *record);
+void pinnacle_trace_decode(const uint8_t *record, struct pinnacle_trace_entry *entry);
+/*
+ * Runs entries through the same STATUS1 filtering and packet processing as live data, back to
+ * back, so the emitted input events can be compared against a reference. The replay runs on the
+ * driver's work queue between live packets and blocks until it's done, or on the caller's
+ * thread while the pad is PM suspended; input callbacks run on that thread. With
+ * CONFIG_INPUT_PINNACLE_COALESCE motion is flushed after every packet instead of on the
+ * coalescing timer. Button, motion accumulator, absolute position and gesture state are reset
+ * first, so replaying the same entries always emits the same events. Replayed packets don't
+ * count towards the packet and coalescing counters, the adaptive sample rate and sleep
+ * interval, or the stats histograms, and never touch the bus. Live packets decoded between two
+ * calls still move the shared state, so keep the pad idle for exact comparisons.
+ * Returns the number of packets processed.
+ */
+int pinnacle_trace_replay(const struct device *dev, const struct pinnacle_trace_entry *entries,
+                          size_t count);
+// Like pinnacle_trace_replay(), but carries on from the state the previous replay left behind
+int pinnacle_trace_replay_continue(const struct device *dev,
+                                   const struct pinnacle_trace_entry *entries, size_t count);
+#endif
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_GESTURES)
+// Feeds one absolute sample to the gesture engine; true if the motion was consumed by a gesture
+bool pinnacle_gesture_process(const struct device *dev, bool touch, uint16_t x, uint16_t y,
+                              int32_t dx, int32_t dy);
+#endif
+
+// Idle sleeper transitions: requested by activity changes, and actually applied to the chip
+struct pinnacle_sleeper_stats {
+    uint32_t requested;
+    uint32_t applied;
+};
+
+int pinnacle_sleeper_get_stats(const struct device *dev, struct pinnacle_sleeper_stats *stats);
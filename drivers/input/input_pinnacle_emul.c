@@ -0,0 +1,451 @@
+#define DT_DRV_COMPAT cirque_pinnacle
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/drivers/spi_emul.h>
+#if IS_ENABLED(CONFIG_GPIO_EMUL)
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#endif
+
+#include <zephyr/logging/log.h>
+
+#include "input_pinnacle.h"
+#include "input_pinnacle_emul.h"
+
+LOG_MODULE_REGISTER(pinnacle_emul, CONFIG_INPUT_LOG_LEVEL);
+
+#define PINNACLE_EMUL_REG_SPACE 0x20
+#define PINNACLE_EMUL_ERA_SIZE 0x0200
+#define PINNACLE_EMUL_XFER_MAX 64
+#define PINNACLE_EMUL_QUEUE_LEN 8
+
+struct pinnacle_emul_data {
+    uint8_t regs[PINNACLE_EMUL_REG_SPACE];
+    uint8_t era[PINNACLE_EMUL_ERA_SIZE];
+    uint8_t cal_latency;
+    uint8_t cal_reads_left;
+    // Packets waiting for the host to clear SW_DR on the current one
+    uint8_t queue[PINNACLE_EMUL_QUEUE_LEN][PINNACLE_PACKET_MAX_LEN];
+    uint8_t queue_lens[PINNACLE_EMUL_QUEUE_LEN];
+    size_t queued;
+    struct pinnacle_emul_stats stats;
+};
+
+struct pinnacle_emul_config {
+    const struct gpio_dt_spec dr;
+    uint32_t i2c_bitrate; // 0 on SPI, where the frequency comes with each transfer
+};
+
+static const uint8_t pinnacle_emul_reg_defaults[PINNACLE_EMUL_REG_SPACE] = {
+    [PINNACLE_FW_ID] = 0x07,
+    [PINNACLE_FW_VER] = 0x3A,
+    [PINNACLE_CAL_CFG] = 0x14,
+    [PINNACLE_SAMPLE] = 100,
+    [PINNACLE_Z_IDLE] = 0x1E,
+    [PINNACLE_Z_SCALER] = 0x08,
+    [PINNACLE_SLEEP_INTERVAL] = 0x49,
+    [PINNACLE_SLEEP_TIMER] = 0x27,
+};
+
+static void pinnacle_emul_add_wire_time(const struct emul *target, uint32_t bits, uint32_t hz) {
+    struct pinnacle_emul_data *data = target->data;
+
+    if (hz > 0) {
+        data->stats.wire_ns += (uint64_t)bits * NSEC_PER_SEC / hz;
+    }
+}
+
+static void pinnacle_emul_update_dr(const struct emul *target) {
+    struct pinnacle_emul_data *data = target->data;
+
+    pinnacle_emul_set_dr(target, (data->regs[PINNACLE_STATUS1] &
+                                  (PINNACLE_STATUS1_SW_DR | PINNACLE_STATUS1_SW_CC)) != 0);
+}
+
+static void pinnacle_emul_reset(const struct emul *target) {
+    struct pinnacle_emul_data *data = target->data;
+
+    memcpy(data->regs, pinnacle_emul_reg_defaults, sizeof(data->regs));
+    data->cal_reads_left = 0;
+    data->queued = 0;
+    data->regs[PINNACLE_STATUS1] = PINNACLE_STATUS1_SW_CC;
+    pinnacle_emul_update_dr(target);
+}
+
+static void pinnacle_emul_load_packet(const struct emul *target, const uint8_t *packet,
+                                      size_t len) {
+    struct pinnacle_emul_data *data = target->data;
+
+    memcpy(&data->regs[PINNACLE_2_2_PACKET0], packet, len);
+    data->regs[PINNACLE_STATUS1] |= PINNACLE_STATUS1_SW_DR;
+}
+
+static void pinnacle_emul_pop_packet(const struct emul *target) {
+    struct pinnacle_emul_data *data = target->data;
+
+    pinnacle_emul_load_packet(target, data->queue[0], data->queue_lens[0]);
+
+    data->queued--;
+    memmove(data->queue[0], data->queue[1], data->queued * sizeof(data->queue[0]));
+    memmove(&data->queue_lens[0], &data->queue_lens[1], data->queued);
+}
+
+static void pinnacle_emul_era_access(const struct emul *target, uint8_t control) {
+    struct pinnacle_emul_data *data = target->data;
+    uint16_t addr = (data->regs[PINNACLE_REG_ERA_HIGH_BYTE] << 8) |
+                    data->regs[PINNACLE_REG_ERA_LOW_BYTE];
+
+    data->stats.era_ops++;
+    if (addr < PINNACLE_EMUL_ERA_SIZE) {
+        if (control & PINNACLE_ERA_CONTROL_READ) {
+            data->regs[PINNACLE_REG_ERA_VALUE] = data->era[addr];
+        } else if (control & PINNACLE_ERA_CONTROL_WRITE) {
+            data->era[addr] = data->regs[PINNACLE_REG_ERA_VALUE];
+        }
+    } else {
+        LOG_WRN("ERA access out of range: 0x%04x", addr);
+    }
+
+    if (control & PINNACLE_ERA_CONTROL_AUTO_INC) {
+        addr++;
+        data->regs[PINNACLE_REG_ERA_HIGH_BYTE] = addr >> 8;
+        data->regs[PINNACLE_REG_ERA_LOW_BYTE] = addr & 0xFF;
+    }
+
+    // The emulated ASIC completes ERA operations immediately
+    data->regs[PINNACLE_REG_ERA_CONTROL] = 0;
+    data->regs[PINNACLE_STATUS1] |= PINNACLE_STATUS1_SW_CC;
+    pinnacle_emul_update_dr(target);
+}
+
+// A lone read of a completion flag is a driver wait poll, unlike a block read covering it
+static void pinnacle_emul_count_poll(const struct emul *target, uint8_t reg, size_t len) {
+    struct pinnacle_emul_data *data = target->data;
+
+    reg &= PINNACLE_EMUL_REG_SPACE - 1;
+    if (len == 1 && (reg == PINNACLE_REG_ERA_CONTROL || reg == PINNACLE_CAL_CFG)) {
+        data->stats.wait_polls++;
+    }
+}
+
+static uint8_t pinnacle_emul_reg_read(const struct emul *target, uint8_t reg) {
+    struct pinnacle_emul_data *data = target->data;
+
+    reg &= PINNACLE_EMUL_REG_SPACE - 1;
+    data->stats.reg_reads++;
+
+    if (reg == PINNACLE_CAL_CFG && data->cal_reads_left > 0 && --data->cal_reads_left == 0) {
+        data->regs[PINNACLE_CAL_CFG] &= ~0x01;
+        data->regs[PINNACLE_STATUS1] |= PINNACLE_STATUS1_SW_CC;
+        pinnacle_emul_update_dr(target);
+    }
+
+    return data->regs[reg];
+}
+
+static void pinnacle_emul_reg_write(const struct emul *target, uint8_t reg, uint8_t val) {
+    struct pinnacle_emul_data *data = target->data;
+
+    reg &= PINNACLE_EMUL_REG_SPACE - 1;
+    data->stats.reg_writes++;
+
+    switch (reg) {
+    case PINNACLE_FW_ID:
+    case PINNACLE_FW_VER:
+        break;
+    case PINNACLE_STATUS1:
+        data->regs[reg] = val & (PINNACLE_STATUS1_SW_DR | PINNACLE_STATUS1_SW_CC);
+        // The next packet lands before DR has a chance to drop, so it raises no edge
+        if (!(data->regs[reg] & PINNACLE_STATUS1_SW_DR) && data->queued > 0) {
+            pinnacle_emul_pop_packet(target);
+        }
+        pinnacle_emul_update_dr(target);
+        break;
+    case PINNACLE_SYS_CFG:
+        if (val & PINNACLE_SYS_CFG_RESET) {
+            pinnacle_emul_reset(target);
+        } else {
+            data->regs[reg] = val;
+        }
+        break;
+    case PINNACLE_CAL_CFG:
+        data->regs[reg] = val;
+        if (val & 0x01) {
+            data->stats.calibrations++;
+            data->cal_reads_left = MAX(data->cal_latency, 1);
+        }
+        break;
+    case PINNACLE_REG_ERA_CONTROL:
+        pinnacle_emul_era_access(target, val);
+        break;
+    default:
+        data->regs[reg] = val;
+        break;
+    }
+}
+
+/*
+ * Runs a flattened RAP command stream: either a read command followed by filler bytes, or one or
+ * more write command/value pairs. Bytes returned for the read command itself are filler.
+ */
+static void pinnacle_emul_rap(const struct emul *target, const uint8_t *tx, uint8_t *rx,
+                              size_t len, size_t read_skip) {
+    struct pinnacle_emul_data *data = target->data;
+
+    if (len == 0) {
+        return;
+    }
+
+    data->stats.transactions++;
+    data->stats.bytes += len;
+
+    if ((tx[0] & 0xE0) == PINNACLE_READ) {
+        uint8_t reg = tx[0] & 0x1F;
+
+        pinnacle_emul_count_poll(target, reg, len - MIN(len, read_skip));
+        for (size_t i = 0; i < len; i++) {
+            rx[i] = i < read_skip ? PINNACLE_FILLER : pinnacle_emul_reg_read(target, reg++);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i + 1 < len; i += 2) {
+        rx[i] = PINNACLE_FILLER;
+        rx[i + 1] = PINNACLE_FILLER;
+        if ((tx[i] & 0xE0) != PINNACLE_WRITE) {
+            LOG_WRN("Unexpected RAP command 0x%02x", tx[i]);
+            continue;
+        }
+        pinnacle_emul_reg_write(target, tx[i] & 0x1F, tx[i + 1]);
+    }
+}
+
+#if DT_ANY_INST_ON_BUS_STATUS_OKAY(spi)
+
+static int pinnacle_emul_spi_io(const struct emul *target, const struct spi_config *config,
+                                const struct spi_buf_set *tx_bufs,
+                                const struct spi_buf_set *rx_bufs) {
+    uint8_t tx[PINNACLE_EMUL_XFER_MAX], rx[PINNACLE_EMUL_XFER_MAX];
+    size_t len = 0;
+
+    if (!tx_bufs) {
+        return -EINVAL;
+    }
+
+    for (size_t i = 0; i < tx_bufs->count; i++) {
+        const struct spi_buf *buf = &tx_bufs->buffers[i];
+
+        if (len + buf->len > sizeof(tx)) {
+            return -ENOMEM;
+        }
+        if (buf->buf) {
+            memcpy(&tx[len], buf->buf, buf->len);
+        } else {
+            memset(&tx[len], 0, buf->len);
+        }
+        len += buf->len;
+    }
+
+    // The ASIC clocks out a filler byte and two more bytes before read data appears
+    pinnacle_emul_rap(target, tx, rx, len, 3);
+    pinnacle_emul_add_wire_time(target, len * 8, config->frequency);
+
+    if (rx_bufs) {
+        size_t pos = 0;
+
+        for (size_t i = 0; i < rx_bufs->count && pos < len; i++) {
+            const struct spi_buf *buf = &rx_bufs->buffers[i];
+            size_t n = MIN(buf->len, len - pos);
+
+            if (buf->buf) {
+                memcpy(buf->buf, &rx[pos], n);
+            }
+            pos += n;
+        }
+    }
+
+    return 0;
+}
+
+static struct spi_emul_api pinnacle_emul_spi_api = {
+    .io = pinnacle_emul_spi_io,
+};
+
+#endif // DT_ANY_INST_ON_BUS_STATUS_OKAY(spi)
+
+#if DT_ANY_INST_ON_BUS_STATUS_OKAY(i2c)
+
+static int pinnacle_emul_i2c_transfer(const struct emul *target, struct i2c_msg *msgs,
+                                      int num_msgs, int addr) {
+    const struct pinnacle_emul_config *config = target->cfg;
+    uint8_t scratch[PINNACLE_EMUL_XFER_MAX];
+    uint8_t read_reg = 0;
+
+    ARG_UNUSED(addr);
+
+    for (int i = 0; i < num_msgs; i++) {
+        struct i2c_msg *msg = &msgs[i];
+
+        if (msg->len > sizeof(scratch)) {
+            return -ENOMEM;
+        }
+
+        // Start or repeated start, address byte and data bytes, each byte with its ACK bit
+        pinnacle_emul_add_wire_time(target, 1 + (msg->len + 1) * 9, config->i2c_bitrate);
+
+        if (msg->flags & I2C_MSG_READ) {
+            struct pinnacle_emul_data *data = target->data;
+
+            data->stats.transactions++;
+            data->stats.bytes += msg->len;
+            pinnacle_emul_count_poll(target, read_reg, msg->len);
+            for (uint32_t j = 0; j < msg->len; j++) {
+                msg->buf[j] = pinnacle_emul_reg_read(target, read_reg++);
+            }
+            continue;
+        }
+
+        if (msg->len == 1 && (msg->buf[0] & 0xE0) == PINNACLE_READ) {
+            struct pinnacle_emul_data *data = target->data;
+
+            data->stats.bytes++;
+            read_reg = msg->buf[0] & 0x1F;
+            continue;
+        }
+
+        pinnacle_emul_rap(target, msg->buf, scratch, msg->len, 0);
+    }
+
+    return 0;
+}
+
+static struct i2c_emul_api pinnacle_emul_i2c_api = {
+    .transfer = pinnacle_emul_i2c_transfer,
+};
+
+#endif // DT_ANY_INST_ON_BUS_STATUS_OKAY(i2c)
+
+int pinnacle_emul_push_packet(const struct emul *target, const uint8_t *packet, size_t len) {
+    if (len > PINNACLE_EMUL_REG_SPACE - PINNACLE_2_2_PACKET0) {
+        return -EINVAL;
+    }
+
+    pinnacle_emul_load_packet(target, packet, len);
+    pinnacle_emul_update_dr(target);
+
+    return 0;
+}
+
+int pinnacle_emul_queue_packet(const struct emul *target, const uint8_t *packet, size_t len) {
+    struct pinnacle_emul_data *data = target->data;
+
+    if (len > PINNACLE_PACKET_MAX_LEN) {
+        return -EINVAL;
+    }
+
+    if (data->queued == PINNACLE_EMUL_QUEUE_LEN) {
+        return -ENOMEM;
+    }
+
+    memcpy(data->queue[data->queued], packet, len);
+    data->queue_lens[data->queued++] = len;
+
+    return 0;
+}
+
+int pinnacle_emul_set_dr(const struct emul *target, bool asserted) {
+    const struct pinnacle_emul_config *config = target->cfg;
+
+    if (!config->dr.port) {
+        return -ENOTSUP;
+    }
+
+#if IS_ENABLED(CONFIG_GPIO_EMUL)
+    bool active_low = (config->dr.dt_flags & GPIO_ACTIVE_LOW) != 0;
+
+    return gpio_emul_input_set(config->dr.port, config->dr.pin, asserted != active_low);
+#else
+    ARG_UNUSED(asserted);
+    return -ENOTSUP;
+#endif
+}
+
+uint8_t pinnacle_emul_reg_get(const struct emul *target, uint8_t reg) {
+    struct pinnacle_emul_data *data = target->data;
+
+    return data->regs[reg & (PINNACLE_EMUL_REG_SPACE - 1)];
+}
+
+int pinnacle_emul_era_get(const struct emul *target, uint16_t addr, uint8_t *val) {
+    struct pinnacle_emul_data *data = target->data;
+
+    if (addr >= PINNACLE_EMUL_ERA_SIZE) {
+        return -EINVAL;
+    }
+
+    *val = data->era[addr];
+    return 0;
+}
+
+int pinnacle_emul_era_set(const struct emul *target, uint16_t addr, uint8_t val) {
+    struct pinnacle_emul_data *data = target->data;
+
+    if (addr >= PINNACLE_EMUL_ERA_SIZE) {
+        return -EINVAL;
+    }
+
+    data->era[addr] = val;
+    return 0;
+}
+
+void pinnacle_emul_set_cal_latency(const struct emul *target, uint8_t reads) {
+    struct pinnacle_emul_data *data = target->data;
+
+    data->cal_latency = reads;
+}
+
+void pinnacle_emul_get_stats(const struct emul *target, struct pinnacle_emul_stats *stats) {
+    struct pinnacle_emul_data *data = target->data;
+
+    *stats = data->stats;
+}
+
+void pinnacle_emul_reset_stats(const struct emul *target) {
+    struct pinnacle_emul_data *data = target->data;
+
+    memset(&data->stats, 0, sizeof(data->stats));
+}
+
+static int pinnacle_emul_init(const struct emul *target, const struct device *parent) {
+    struct pinnacle_emul_data *data = target->data;
+
+    ARG_UNUSED(parent);
+
+    memset(data->era, 0, sizeof(data->era));
+    data->era[PINNACLE_ERA_REG_X_AXIS_WIDE_Z_MIN] = 0x06;
+    data->era[PINNACLE_ERA_REG_Y_AXIS_WIDE_Z_MIN] = 0x05;
+    data->era[PINNACLE_ERA_REG_TRACKING_ADC_CONFIG] = 0x4E;
+    data->cal_latency = 3;
+    pinnacle_emul_reset(target);
+
+    return 0;
+}
+
+#define PINNACLE_EMUL(n)                                                                           \
+    static struct pinnacle_emul_data pinnacle_emul_data_##n;                                       \
+    static const struct pinnacle_emul_config pinnacle_emul_config_##n = {                          \
+        .dr = GPIO_DT_SPEC_INST_GET_OR(n, dr_gpios, {}),                                           \
+        .i2c_bitrate = COND_CODE_1(DT_INST_ON_BUS(n, i2c),                                         \
+                                   (DT_PROP_OR(DT_INST_BUS(n), clock_frequency, 0)), (0)),         \
+    };                                                                                             \
+    EMUL_DT_INST_DEFINE(n, pinnacle_emul_init, &pinnacle_emul_data_##n,                            \
+                        &pinnacle_emul_config_##n,                                                 \
+                        COND_CODE_1(DT_INST_ON_BUS(n, i2c), (&pinnacle_emul_i2c_api),              \
+                                    (&pinnacle_emul_spi_api)),                                     \
+                        NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(PINNACLE_EMUL)
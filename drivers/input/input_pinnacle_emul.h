@@ -0,0 +1,36 @@
+#pragma once
+
+#include <zephyr/drivers/emul.h>
+
+struct pinnacle_emul_stats {
+    uint32_t transactions;
+    uint32_t bytes;
+    uint32_t reg_reads;
+    uint32_t reg_writes;
+    uint32_t era_ops;
+    uint32_t calibrations; // forced calibrations started
+    // Transactions reading ERA_CONTROL or CAL_CFG alone, i.e. ERA and calibration completion polls
+    uint32_t wait_polls;
+    uint64_t wire_ns; // modeled time on the wire, from byte counts and the bus clock
+};
+
+// Load a relative/absolute packet into the packet registers, set SW_DR and assert DR
+int pinnacle_emul_push_packet(const struct emul *target, const uint8_t *packet, size_t len);
+
+// Queue a packet that lands as soon as the host clears SW_DR on the current one. DR stays
+// asserted across that clear, so the packet raises no edge, like one arriving while the clear is
+// in flight
+int pinnacle_emul_queue_packet(const struct emul *target, const uint8_t *packet, size_t len);
+
+// Drive the DR line directly, independent of STATUS1, e.g. to drop or repeat an edge
+int pinnacle_emul_set_dr(const struct emul *target, bool asserted);
+
+uint8_t pinnacle_emul_reg_get(const struct emul *target, uint8_t reg);
+int pinnacle_emul_era_get(const struct emul *target, uint16_t addr, uint8_t *val);
+int pinnacle_emul_era_set(const struct emul *target, uint16_t addr, uint8_t val);
+
+// Number of CAL_CFG reads before a forced calibration reports completion
+void pinnacle_emul_set_cal_latency(const struct emul *target, uint8_t reads);
+
+void pinnacle_emul_get_stats(const struct emul *target, struct pinnacle_emul_stats *stats);
+void pinnacle_emul_reset_stats(const struct emul *target);
@@ -0,0 +1,198 @@
+#include <zephyr/device.h>
+#include <zephyr/dt-bindings/input/input-event-codes.h>
+#include <zephyr/input/input.h>
+
+#include <zephyr/logging/log.h>
+
+#include "input_pinnacle.h"
+
+LOG_MODULE_DECLARE(pinnacle, CONFIG_INPUT_LOG_LEVEL);
+
+#define PINNACLE_ANGLE_TURN 1024
+
+#define PINNACLE_ABS_X_CENTER ((PINNACLE_ABS_X_MIN + PINNACLE_ABS_X_MAX) / 2)
+#define PINNACLE_ABS_Y_CENTER ((PINNACLE_ABS_Y_MIN + PINNACLE_ABS_Y_MAX) / 2)
+#define PINNACLE_ABS_X_RADIUS ((PINNACLE_ABS_X_MAX - PINNACLE_ABS_X_MIN) / 2)
+#define PINNACLE_ABS_Y_RADIUS ((PINNACLE_ABS_Y_MAX - PINNACLE_ABS_Y_MIN) / 2)
+
+// atan(i / 32) in 1/PINNACLE_ANGLE_TURN turns, for i = 0..32
+static const uint8_t pinnacle_atan_lut[33] = {
+    0,  5,  10, 15, 20, 25, 30,  35,  40,  45,  49,  54,  58,  63,  67,  71, 76,
+    80, 84, 87, 91, 95, 98, 102, 105, 108, 111, 114, 117, 120, 123, 125, 128,
+};
+
+// Angle of (x, y) in 1/PINNACLE_ANGLE_TURN turns, counter-clockwise from +x
+static int32_t pinnacle_angle(int32_t x, int32_t y) {
+    int32_t ax = ABS(x), ay = ABS(y);
+    int32_t a;
+
+    if (ax == 0 && ay == 0) {
+        return 0;
+    }
+
+    if (ax >= ay) {
+        a = pinnacle_atan_lut[ay * 32 / ax];
+    } else {
+        a = PINNACLE_ANGLE_TURN / 4 - pinnacle_atan_lut[ax * 32 / ay];
+    }
+
+    if (x < 0) {
+        a = PINNACLE_ANGLE_TURN / 2 - a;
+    }
+    if (y < 0) {
+        a = PINNACLE_ANGLE_TURN - a;
+    }
+
+    return a % PINNACLE_ANGLE_TURN;
+}
+
+// Position relative to the pad center, with Y scaled so the pad's ellipse becomes a circle
+static void pinnacle_gesture_polar(uint16_t x, uint16_t y, int32_t *px, int32_t *py) {
+    *px = ((int32_t)x - PINNACLE_ABS_X_CENTER) * PINNACLE_ABS_Y_RADIUS;
+    *py = ((int32_t)y - PINNACLE_ABS_Y_CENTER) * PINNACLE_ABS_X_RADIUS;
+}
+
+static bool pinnacle_gesture_in_ring(const struct pinnacle_gesture_config *cfg, uint16_t x,
+                                     uint16_t y) {
+    int32_t px, py;
+    int64_t r = (int64_t)PINNACLE_ABS_X_RADIUS * PINNACLE_ABS_Y_RADIUS * cfg->circular_ring_pct /
+                100;
+
+    pinnacle_gesture_polar(x, y, &px, &py);
+    return (int64_t)px * px + (int64_t)py * py >= r * r;
+}
+
+static const struct pinnacle_gesture_zone *
+pinnacle_gesture_find_zone(const struct pinnacle_gesture_config *cfg, uint16_t x, uint16_t y) {
+    for (size_t i = 0; i < cfg->zone_count; i++) {
+        const struct pinnacle_gesture_zone *zone = &cfg->zones[i];
+
+        if (zone->type == PINNACLE_GESTURE_TAP && zone->code == 0) {
+            continue;
+        }
+
+        if (x >= zone->x_min && x <= zone->x_max && y >= zone->y_min && y <= zone->y_max) {
+            return zone;
+        }
+    }
+
+    return NULL;
+}
+
+// Accumulates delta and emits whole steps of the given size on the given axis
+static void pinnacle_gesture_scroll(const struct device *dev, uint16_t code, int32_t delta,
+                                    uint16_t step) {
+    const struct pinnacle_config *config = dev->config;
+    struct pinnacle_gesture_data *g = &((struct pinnacle_data *)dev->data)->gesture;
+
+    g->acc += config->scroll_invert ? -delta : delta;
+
+    int32_t steps = g->acc / step;
+    if (steps == 0) {
+        return;
+    }
+
+    g->acc -= steps * step;
+    input_report_rel(dev, code, steps, true, K_FOREVER);
+}
+
+static void pinnacle_gesture_touch_down(const struct device *dev, uint16_t x, uint16_t y) {
+    const struct pinnacle_config *config = dev->config;
+    const struct pinnacle_gesture_config *cfg = &config->gestures;
+    struct pinnacle_gesture_data *g = &((struct pinnacle_data *)dev->data)->gesture;
+    const struct pinnacle_gesture_zone *zone = pinnacle_gesture_find_zone(cfg, x, y);
+
+    g->start_ms = k_uptime_get_32();
+    g->travel = 0;
+    g->acc = 0;
+    g->active = PINNACLE_GESTURE_NONE;
+
+    if (zone) {
+        g->active = zone->type;
+        g->code = zone->code;
+    } else if (cfg->circular_scroll && pinnacle_gesture_in_ring(cfg, x, y)) {
+        int32_t px, py;
+
+        pinnacle_gesture_polar(x, y, &px, &py);
+        g->active = PINNACLE_GESTURE_CIRCULAR;
+        g->angle = pinnacle_angle(px, py);
+    }
+
+    if (g->active != PINNACLE_GESTURE_NONE) {
+        LOG_DBG("Gesture %d started at %d,%d", g->active, x, y);
+    }
+}
+
+static void pinnacle_gesture_lift_off(const struct device *dev) {
+    struct pinnacle_gesture_data *g = &((struct pinnacle_data *)dev->data)->gesture;
+
+    if (g->active == PINNACLE_GESTURE_TAP &&
+        k_uptime_get_32() - g->start_ms <= CONFIG_INPUT_PINNACLE_GESTURE_TAP_MS) {
+        input_report_key(dev, g->code, 1, true, K_FOREVER);
+        input_report_key(dev, g->code, 0, true, K_FOREVER);
+    }
+
+    g->active = PINNACLE_GESTURE_NONE;
+}
+
+/*
+ * Runs once per absolute packet. Work per packet is one zone table scan on touch down and O(1)
+ * otherwise. Returns true when the motion was used by a gesture and must not move the pointer.
+ */
+bool pinnacle_gesture_process(const struct device *dev, bool touch, uint16_t x, uint16_t y,
+                              int32_t dx, int32_t dy) {
+    const struct pinnacle_config *config = dev->config;
+    const struct pinnacle_gesture_config *cfg = &config->gestures;
+    struct pinnacle_gesture_data *g = &((struct pinnacle_data *)dev->data)->gesture;
+
+    if (touch != g->touching) {
+        g->touching = touch;
+        if (touch) {
+            pinnacle_gesture_touch_down(dev, x, y);
+        } else {
+            pinnacle_gesture_lift_off(dev);
+        }
+        return g->active != PINNACLE_GESTURE_NONE;
+    }
+
+    if (!touch) {
+        return false;
+    }
+
+    switch (g->active) {
+    case PINNACLE_GESTURE_TAP:
+        g->travel += ABS(dx) + ABS(dy);
+        if (g->travel > CONFIG_INPUT_PINNACLE_GESTURE_TAP_MOVE) {
+            // Moved too far for a tap, hand the touch back to the pointer
+            g->active = PINNACLE_GESTURE_NONE;
+            return false;
+        }
+        return true;
+    case PINNACLE_GESTURE_EDGE_V:
+        pinnacle_gesture_scroll(dev, INPUT_REL_WHEEL, dy, cfg->edge_step);
+        return true;
+    case PINNACLE_GESTURE_EDGE_H:
+        pinnacle_gesture_scroll(dev, INPUT_REL_HWHEEL, dx, cfg->edge_step);
+        return true;
+    case PINNACLE_GESTURE_CIRCULAR: {
+        int32_t px, py;
+
+        pinnacle_gesture_polar(x, y, &px, &py);
+        int32_t angle = pinnacle_angle(px, py);
+        int32_t delta = angle - g->angle;
+
+        // Shortest way around, so crossing the 0 angle doesn't look like a full turn
+        if (delta >= PINNACLE_ANGLE_TURN / 2) {
+            delta -= PINNACLE_ANGLE_TURN;
+        } else if (delta < -PINNACLE_ANGLE_TURN / 2) {
+            delta += PINNACLE_ANGLE_TURN;
+        }
+
+        g->angle = angle;
+        pinnacle_gesture_scroll(dev, INPUT_REL_WHEEL, delta, cfg->circular_step);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
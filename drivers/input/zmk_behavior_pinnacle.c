@@ -0,0 +1,99 @@
+#define DT_DRV_COMPAT zmk_behavior_pinnacle
+
+#include <zephyr/device.h>
+#include <drivers/behavior.h>
+#include <dt-bindings/zmk/pinnacle.h>
+#include <zmk/behavior.h>
+#include "input_pinnacle.h"
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(behavior_pinnacle, CONFIG_INPUT_LOG_LEVEL);
+
+struct behavior_pinnacle_config {
+    const struct device *trackpad;
+};
+
+static int on_pinnacle_binding_pressed(struct zmk_behavior_binding *binding,
+                                       struct zmk_behavior_binding_event event) {
+    const struct device *dev = zmk_behavior_get_binding(binding->behavior_dev);
+    const struct behavior_pinnacle_config *config = dev->config;
+    struct pinnacle_settings settings;
+
+    pinnacle_get_settings(config->trackpad, &settings);
+
+    switch (binding->param1) {
+    case PINNACLE_SENS_UP:
+        if (settings.sensitivity < PINNACLE_SENSITIVITY_4X) {
+            settings.sensitivity++;
+        }
+        break;
+    case PINNACLE_SENS_DOWN:
+        if (settings.sensitivity > PINNACLE_SENSITIVITY_1X) {
+            settings.sensitivity--;
+        }
+        break;
+    case PINNACLE_SENS_SET:
+        if (binding->param2 > PINNACLE_SENSITIVITY_4X) {
+            LOG_ERR("Invalid pinnacle sensitivity %d", binding->param2);
+            return -EINVAL;
+        }
+        settings.sensitivity = binding->param2;
+        break;
+    case PINNACLE_TOG_X_INVERT:
+        settings.x_invert = !settings.x_invert;
+        break;
+    case PINNACLE_TOG_Y_INVERT:
+        settings.y_invert = !settings.y_invert;
+        break;
+    case PINNACLE_TOG_ROTATE_90:
+        settings.rotate_90 = !settings.rotate_90;
+        break;
+    case PINNACLE_TOG_TAPS:
+        settings.no_taps = !settings.no_taps;
+        break;
+    case PINNACLE_TOG_SECONDARY_TAP:
+        settings.no_secondary_tap = !settings.no_secondary_tap;
+        break;
+    case PINNACLE_Z_MIN_SET:
+        if (binding->param2 > UINT8_MAX) {
+            LOG_ERR("Invalid pinnacle Z min %d", binding->param2);
+            return -EINVAL;
+        }
+        settings.x_axis_z_min = binding->param2;
+        settings.y_axis_z_min = binding->param2;
+        break;
+    default:
+        LOG_ERR("Unknown pinnacle command %d", binding->param1);
+        return -ENOTSUP;
+    }
+
+    // ERA writes can take a while, so they run on the driver's work queue, not the keymap's
+    int ret = pinnacle_set_settings_async(config->trackpad, &settings);
+    if (ret < 0) {
+        LOG_ERR("Failed to apply pinnacle command %d: %d", binding->param1, ret);
+    }
+
+    return ZMK_BEHAVIOR_OPAQUE;
+}
+
+static int on_pinnacle_binding_released(struct zmk_behavior_binding *binding,
+                                        struct zmk_behavior_binding_event event) {
+    return ZMK_BEHAVIOR_OPAQUE;
+}
+
+static const struct behavior_driver_api behavior_pinnacle_driver_api = {
+    // The trackpad device only exists on the central, see the binding
+    .locality = BEHAVIOR_LOCALITY_CENTRAL,
+    .binding_pressed = on_pinnacle_binding_pressed,
+    .binding_released = on_pinnacle_binding_released,
+};
+
+#define PINNACLE_BEHAVIOR_INST(n)                                                                  \
+    static const struct behavior_pinnacle_config behavior_pinnacle_config_##n = {                  \
+        .trackpad = DEVICE_DT_GET(DT_INST_PHANDLE(n, trackpad)),                                   \
+    };                                                                                             \
+    BEHAVIOR_DT_INST_DEFINE(n, NULL, NULL, NULL, &behavior_pinnacle_config_##n, POST_KERNEL,       \
+                            CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &behavior_pinnacle_driver_api);
+
+DT_INST_FOREACH_STATUS_OKAY(PINNACLE_BEHAVIOR_INST)
@@ -2,6 +2,8 @@
 
 #include <zephyr/device.h>
 #include <zephyr/devicetree.h>
+#include <zephyr/init.h>
+#include <zephyr/pm/device.h>
 #include <zmk/event_manager.h>
 #include <zmk/events/activity_state_changed.h>
 #include "input_pinnacle.h"
@@ -10,12 +12,97 @@
 
 LOG_MODULE_REGISTER(pinnacle_sleeper, CONFIG_INPUT_LOG_LEVEL);
 
-#define GET_PINNACLE(node_id) DEVICE_DT_GET(node_id),
+enum pinnacle_sleeper_state {
+    PINNACLE_SLEEPER_UNKNOWN,
+    PINNACLE_SLEEPER_AWAKE,
+    PINNACLE_SLEEPER_SLEEP,
+    PINNACLE_SLEEPER_SHUTDOWN,
+};
+
+struct pinnacle_sleeper {
+    const struct device *dev;
+    struct k_work work;
+#if IS_ENABLED(CONFIG_ZMK_INPUT_PINNACLE_IDLE_SLEEPER_SHUTDOWN)
+    struct k_work_delayable shutdown_work;
+#endif
+    // Written by the listener, consumed by the work item, so only the latest state is applied
+    atomic_t target;
+    enum pinnacle_sleeper_state applied;
+    // Bumped from both the listener and the shutdown work, so kept atomic
+    atomic_t requested;
+    // Only bumped by the work item, but read by pinnacle_sleeper_get_stats() from any thread
+    atomic_t applied_count;
+};
 
-static const struct device *pinnacle_devs[] = {
+#define GET_PINNACLE(node_id) {.dev = DEVICE_DT_GET(node_id)},
+
+static struct pinnacle_sleeper pinnacle_sleepers[] = {
     DT_FOREACH_STATUS_OKAY(cirque_pinnacle, GET_PINNACLE)
 };
 
+static int pinnacle_sleeper_apply(struct pinnacle_sleeper *sleeper,
+                                  enum pinnacle_sleeper_state state) {
+#if IS_ENABLED(CONFIG_ZMK_INPUT_PINNACLE_IDLE_SLEEPER_SHUTDOWN)
+    if (sleeper->applied == PINNACLE_SLEEPER_SHUTDOWN) {
+        int ret = pm_device_action_run(sleeper->dev, PM_DEVICE_ACTION_RESUME);
+        if (ret < 0 && ret != -EALREADY) {
+            return ret;
+        }
+    }
+
+    if (state == PINNACLE_SLEEPER_SHUTDOWN) {
+        return pm_device_action_run(sleeper->dev, PM_DEVICE_ACTION_SUSPEND);
+    }
+#endif
+
+    return pinnacle_set_sleep(sleeper->dev, state == PINNACLE_SLEEPER_SLEEP);
+}
+
+static void pinnacle_sleeper_work_cb(struct k_work *work) {
+    struct pinnacle_sleeper *sleeper = CONTAINER_OF(work, struct pinnacle_sleeper, work);
+    enum pinnacle_sleeper_state state = atomic_get(&sleeper->target);
+
+    if (state == sleeper->applied) {
+        return;
+    }
+
+    int ret = pinnacle_sleeper_apply(sleeper, state);
+    if (ret < 0) {
+        LOG_WRN("Failed to apply sleep state %d to %s: %d", state, sleeper->dev->name, ret);
+        return;
+    }
+
+    sleeper->applied = state;
+    atomic_inc(&sleeper->applied_count);
+}
+
+#if IS_ENABLED(CONFIG_ZMK_INPUT_PINNACLE_IDLE_SLEEPER_SHUTDOWN)
+
+// Deeper tier: still idle after the shutdown delay, so go from sleep to shutdown
+static void pinnacle_sleeper_shutdown_cb(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct pinnacle_sleeper *sleeper = CONTAINER_OF(dwork, struct pinnacle_sleeper, shutdown_work);
+
+    if (atomic_cas(&sleeper->target, PINNACLE_SLEEPER_SLEEP, PINNACLE_SLEEPER_SHUTDOWN)) {
+        atomic_inc(&sleeper->requested);
+        k_work_submit(&sleeper->work);
+    }
+}
+
+#endif // IS_ENABLED(CONFIG_ZMK_INPUT_PINNACLE_IDLE_SLEEPER_SHUTDOWN)
+
+int pinnacle_sleeper_get_stats(const struct device *dev, struct pinnacle_sleeper_stats *stats) {
+    for (size_t i = 0; i < ARRAY_SIZE(pinnacle_sleepers); i++) {
+        if (pinnacle_sleepers[i].dev == dev) {
+            stats->requested = atomic_get(&pinnacle_sleepers[i].requested);
+            stats->applied = atomic_get(&pinnacle_sleepers[i].applied_count);
+            return 0;
+        }
+    }
+
+    return -ENODEV;
+}
+
 static int on_activity_state(const zmk_event_t *eh) {
     struct zmk_activity_state_changed *state_ev = as_zmk_activity_state_changed(eh);
 
@@ -24,13 +111,40 @@ static int on_activity_state(const zmk_event_t *eh) {
         return 0;
     }
 
-    bool sleep = state_ev->state == ZMK_ACTIVITY_ACTIVE ? 0 : 1;
-    for (size_t i = 0; i < ARRAY_SIZE(pinnacle_devs); i++) {
-        pinnacle_set_sleep(pinnacle_devs[i], sleep);
+    bool active = state_ev->state == ZMK_ACTIVITY_ACTIVE;
+    for (size_t i = 0; i < ARRAY_SIZE(pinnacle_sleepers); i++) {
+        struct pinnacle_sleeper *sleeper = &pinnacle_sleepers[i];
+
+        atomic_set(&sleeper->target, active ? PINNACLE_SLEEPER_AWAKE : PINNACLE_SLEEPER_SLEEP);
+        atomic_inc(&sleeper->requested);
+        // No-op while already queued, which collapses flapping into the latest state
+        k_work_submit(&sleeper->work);
+
+#if IS_ENABLED(CONFIG_ZMK_INPUT_PINNACLE_IDLE_SLEEPER_SHUTDOWN)
+        if (active) {
+            k_work_cancel_delayable(&sleeper->shutdown_work);
+        } else {
+            k_work_reschedule(&sleeper->shutdown_work,
+                              K_MSEC(CONFIG_ZMK_INPUT_PINNACLE_IDLE_SLEEPER_SHUTDOWN_MS));
+        }
+#endif
+    }
+
+    return 0;
+}
+
+static int pinnacle_sleeper_init(void) {
+    for (size_t i = 0; i < ARRAY_SIZE(pinnacle_sleepers); i++) {
+        k_work_init(&pinnacle_sleepers[i].work, pinnacle_sleeper_work_cb);
+#if IS_ENABLED(CONFIG_ZMK_INPUT_PINNACLE_IDLE_SLEEPER_SHUTDOWN)
+        k_work_init_delayable(&pinnacle_sleepers[i].shutdown_work, pinnacle_sleeper_shutdown_cb);
+#endif
     }
 
     return 0;
 }
 
+SYS_INIT(pinnacle_sleeper_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
 ZMK_LISTENER(zmk_pinnacle_idle_sleeper, on_activity_state);
-ZMK_SUBSCRIPTION(zmk_pinnacle_idle_sleeper, zmk_activity_state_changed);
\ No newline at end of file
+ZMK_SUBSCRIPTION(zmk_pinnacle_idle_sleeper, zmk_activity_state_changed);
@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+// Commands for &pinnacle_cfg; the second binding parameter is only used by the *_SET commands
+#define PINNACLE_SENS_UP 0
+#define PINNACLE_SENS_DOWN 1
+#define PINNACLE_SENS_SET 2
+#define PINNACLE_TOG_X_INVERT 3
+#define PINNACLE_TOG_Y_INVERT 4
+#define PINNACLE_TOG_ROTATE_90 5
+#define PINNACLE_TOG_TAPS 6
+#define PINNACLE_TOG_SECONDARY_TAP 7
+#define PINNACLE_Z_MIN_SET 8
@@ -0,0 +1,367 @@
+#include <stdlib.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/input/input.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#include "input_pinnacle.h"
+#include "input_pinnacle_emul.h"
+
+#define BENCH_PACKETS 256
+#define BENCH_PROCESS_PACKETS 2048
+#define BENCH_CONFIG_WRITES 32
+#define BENCH_REG_READS 256
+// Packets per absolute stroke, the last of which lifts off
+#define BENCH_STROKE_LEN 32
+#define BENCH_PROCESS_STROKES (BENCH_PROCESS_PACKETS / BENCH_STROKE_LEN)
+#define BENCH_ABS_Z 30
+#define BENCH_REPORT_TIMEOUT K_MSEC(100)
+
+#if IS_ENABLED(CONFIG_NATIVE_SIM)
+uint64_t bench_host_ns(void);
+
+typedef uint64_t bench_time_t;
+
+static inline bench_time_t bench_now(void) { return bench_host_ns(); }
+
+static inline uint32_t bench_ns(bench_time_t start, bench_time_t end) {
+    return (uint32_t)(end - start);
+}
+#else
+// Cycle counts only track CPU time on targets that model it, e.g. QEMU with icount
+typedef uint32_t bench_time_t;
+
+static inline bench_time_t bench_now(void) { return k_cycle_get_32(); }
+
+static inline uint32_t bench_ns(bench_time_t start, bench_time_t end) {
+    return (uint32_t)k_cyc_to_ns_floor64(end - start);
+}
+#endif
+
+struct bench_pad {
+    const struct device *dev;
+    const struct emul *emul;
+};
+
+#define BENCH_PAD(node_id) {.dev = DEVICE_DT_GET(node_id), .emul = EMUL_DT_GET(node_id)},
+
+static const struct bench_pad bench_pads[] = {DT_FOREACH_STATUS_OKAY(cirque_pinnacle, BENCH_PAD)};
+
+static K_SEM_DEFINE(bench_report_sem, 0, 1);
+static bench_time_t bench_report_time;
+static uint32_t bench_latency_ns[BENCH_PACKETS];
+static uint32_t bench_process_ns[BENCH_PROCESS_STROKES];
+static uint32_t bench_access_ns[BENCH_REG_READS];
+
+static void bench_input_cb(struct input_event *evt, void *user_data) {
+    ARG_UNUSED(user_data);
+
+    if (evt->sync) {
+        bench_report_time = bench_now();
+        k_sem_give(&bench_report_sem);
+    }
+}
+
+INPUT_CALLBACK_DEFINE(NULL, bench_input_cb, NULL);
+
+static int bench_cmp_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static uint32_t bench_percentile(const uint32_t *sorted, size_t n, unsigned int pct) {
+    return sorted[MIN(n - 1, n * pct / 100)];
+}
+
+static void bench_print_percentiles(const char *label, uint32_t *samples, size_t n) {
+    qsort(samples, n, sizeof(samples[0]), bench_cmp_u32);
+    printk("  %s: p50 %u, p90 %u, p99 %u, max %u\n", label, bench_percentile(samples, n, 50),
+           bench_percentile(samples, n, 90), bench_percentile(samples, n, 99), samples[n - 1]);
+}
+
+// Relative packet with a motion that changes every time and is fast enough to yield a report
+// even through an accel curve that slows small motions down
+static void bench_rel_packet(uint8_t *packet, size_t i) {
+    packet[0] = 0;
+    packet[1] = 8 + i % 7;
+    packet[2] = 8 + i % 5;
+    packet[3] = 0;
+}
+
+// Relative packet sweeping speeds of 0 to 40 counts both ways, which crosses every curve segment
+static void bench_rel_sweep_packet(uint8_t *packet, size_t i) {
+    int8_t dx = (int8_t)(i % 81) - 40;
+    int8_t dy = (int8_t)(i * 7 % 41) - 20;
+
+    packet[0] = (dx < 0 ? PINNACLE_PACKET0_X_SIGN : 0) | (dy < 0 ? PINNACLE_PACKET0_Y_SIGN : 0);
+    packet[1] = (uint8_t)dx;
+    packet[2] = (uint8_t)dy;
+    packet[3] = 0;
+}
+
+static void bench_report_path(const struct bench_pad *pad) {
+    struct pinnacle_emul_stats bus;
+    uint8_t packet[PINNACLE_PACKET_MAX_LEN] = {0};
+    uint32_t reports = 0, missed = 0;
+
+    pinnacle_emul_reset_stats(pad->emul);
+    k_sem_reset(&bench_report_sem);
+
+    bench_time_t start = bench_now();
+    uint32_t start_cycles = k_cycle_get_32();
+
+    for (size_t i = 0; i < BENCH_PACKETS; i++) {
+        bench_rel_packet(packet, i);
+
+        bench_time_t push = bench_now();
+
+        pinnacle_emul_push_packet(pad->emul, packet, PINNACLE_REL_PACKET_LEN);
+        if (k_sem_take(&bench_report_sem, BENCH_REPORT_TIMEOUT) < 0) {
+            missed++;
+            continue;
+        }
+
+        bench_latency_ns[reports++] = bench_ns(push, bench_report_time);
+    }
+
+    uint32_t total_ns = bench_ns(start, bench_now());
+    uint64_t kernel_ns = k_cyc_to_ns_floor64(k_cycle_get_32() - start_cycles);
+
+    pinnacle_emul_get_stats(pad->emul, &bus);
+
+    printk("  %u reports, %u missed\n", reports, missed);
+    if (reports == 0) {
+        return;
+    }
+
+    bench_print_percentiles("packet to report ns", bench_latency_ns, reports);
+    printk("  bus per report: %u bytes, %u transactions\n", bus.bytes / reports,
+           bus.transactions / reports);
+    printk("  bus wire time per report: %u ns\n", (uint32_t)(bus.wire_ns / reports));
+    // On native_sim the kernel clock only moves while threads sleep or busy wait, so this is the
+    // time the driver spends in delays such as the SPI post-write settle
+    printk("  kernel clock per report: %u ns\n", (uint32_t)(kernel_ns / reports));
+    printk("  reports per second: %u\n",
+           (uint32_t)((uint64_t)reports * NSEC_PER_SEC / MAX(total_ns, 1)));
+}
+
+// Configuration register writes, the ones that still take the SPI post-write settle delay
+static void bench_config_writes(const struct bench_pad *pad) {
+    struct pinnacle_emul_stats bus;
+
+    pinnacle_emul_reset_stats(pad->emul);
+
+    uint32_t start_cycles = k_cycle_get_32();
+
+    // Alternate the rate so every call is a real change, ending on 100 samples per second
+    for (size_t i = 0; i < BENCH_CONFIG_WRITES; i++) {
+        pinnacle_set_sample_rate(pad->dev, i % 2 ? 100 : 80);
+    }
+
+    uint64_t kernel_ns = k_cyc_to_ns_floor64(k_cycle_get_32() - start_cycles);
+
+    pinnacle_emul_get_stats(pad->emul, &bus);
+    printk("  config register write: %u ns bus wire time, %u ns kernel clock\n",
+           (uint32_t)(bus.wire_ns / BENCH_CONFIG_WRITES),
+           (uint32_t)(kernel_ns / BENCH_CONFIG_WRITES));
+}
+
+// Kernel uptime, which on native_sim includes the simulated reset and settle sleeps of bring-up
+static uint32_t bench_uptime_us(void) {
+    return (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks());
+}
+
+// How long bring-up holds back main, and when each pad is actually usable
+static bool bench_boot(void) {
+    bool ready = true;
+
+    printk("boot (%s init): main reached at %u us\n",
+           IS_ENABLED(CONFIG_INPUT_PINNACLE_DEFERRED_INIT) ? "deferred" : "blocking",
+           bench_uptime_us());
+
+    for (size_t i = 0; i < ARRAY_SIZE(bench_pads); i++) {
+        const struct bench_pad *pad = &bench_pads[i];
+        int ret = pinnacle_wait_ready(pad->dev, K_SECONDS(2));
+
+        if (ret < 0) {
+            printk("  %s: not ready (%d)\n", pad->dev->name, ret);
+            ready = false;
+            continue;
+        }
+
+        struct pinnacle_emul_stats bus;
+
+        // Nothing resets the emulator counters before this, so they cover the whole bring-up
+        pinnacle_emul_get_stats(pad->emul, &bus);
+        printk("  %s ready by %u us, %u bus transactions, %u of them completion wait polls\n",
+               pad->dev->name, bench_uptime_us(), bus.transactions, bus.wait_polls);
+    }
+
+    return ready;
+}
+
+static void bench_abs_packet(uint8_t *packet, uint16_t x, uint16_t y, uint8_t z) {
+    packet[0] = 0;
+    packet[1] = 0;
+    packet[2] = x & 0xFF;
+    packet[3] = y & 0xFF;
+    packet[4] = ((x >> 8) & 0x0F) | ((y >> 8) & 0x0F) << 4;
+    packet[5] = z;
+}
+
+// Point t of n steps around a rectangle at 90% of the pad radius, clockwise from the top middle
+static void bench_ring_point(size_t t, size_t n, uint16_t *x, uint16_t *y) {
+    const int32_t cx = (PINNACLE_ABS_X_MIN + PINNACLE_ABS_X_MAX) / 2;
+    const int32_t cy = (PINNACLE_ABS_Y_MIN + PINNACLE_ABS_Y_MAX) / 2;
+    const int32_t rx = (PINNACLE_ABS_X_MAX - PINNACLE_ABS_X_MIN) * 9 / 20;
+    const int32_t ry = (PINNACLE_ABS_Y_MAX - PINNACLE_ABS_Y_MIN) * 9 / 20;
+    // Perimeter position in 1/256 sides, starting half way along the top side
+    uint32_t pos = (t * 4 * 256 / n + 128) % (4 * 256);
+    // Position along the current side, from -256 at its start to 256 at its end
+    int32_t f = (int32_t)(pos % 256) * 2 - 256;
+    int32_t px, py;
+
+    switch (pos / 256) {
+    case 0:
+        px = f * rx / 256, py = -ry;
+        break;
+    case 1:
+        px = rx, py = f * ry / 256;
+        break;
+    case 2:
+        px = -f * rx / 256, py = ry;
+        break;
+    default:
+        px = -rx, py = -f * ry / 256;
+        break;
+    }
+
+    *x = cx + px;
+    *y = cy + py;
+}
+
+/*
+ * Absolute strokes cycling through every gesture the bench pad has: a circle on the scroll ring,
+ * a right edge strip stroke, a corner tap and plain pointer motion in the middle.
+ */
+static void bench_abs_stroke_packet(uint8_t *packet, size_t i) {
+    size_t stroke = i / BENCH_STROKE_LEN % 4, t = i % BENCH_STROKE_LEN;
+    uint16_t x, y;
+
+    if (t == BENCH_STROKE_LEN - 1) {
+        bench_abs_packet(packet, 0, 0, 0);
+        return;
+    }
+
+    switch (stroke) {
+    case 0:
+        bench_ring_point(t, BENCH_STROKE_LEN - 1, &x, &y);
+        break;
+    case 1:
+        x = PINNACLE_ABS_X_MAX - 10;
+        y = 300 + t * 25;
+        break;
+    case 2:
+        x = PINNACLE_ABS_X_MIN + 20;
+        y = PINNACLE_ABS_Y_MIN + 20;
+        break;
+    default:
+        x = 900 + t * 6;
+        y = 700 + t * 3;
+        break;
+    }
+
+    bench_abs_packet(packet, x, y, BENCH_ABS_Z);
+}
+
+/*
+ * Packet processing alone. Each stroke goes through the trace replay hook in one call, which runs
+ * the same decode, acceleration and reporting as live data on the driver's work queue without
+ * touching the bus. Timing whole strokes spreads the hand-off to the work queue over its packets.
+ */
+static void bench_process(const struct bench_pad *pad, void (*make_packet)(uint8_t *, size_t)) {
+    static struct pinnacle_trace_entry stroke[BENCH_STROKE_LEN];
+
+    for (size_t s = 0; s < BENCH_PROCESS_STROKES; s++) {
+        for (size_t t = 0; t < BENCH_STROKE_LEN; t++) {
+            stroke[t].status = PINNACLE_STATUS1_SW_DR;
+            make_packet(stroke[t].packet, s * BENCH_STROKE_LEN + t);
+        }
+
+        bench_time_t start = bench_now();
+
+        pinnacle_trace_replay(pad->dev, stroke, BENCH_STROKE_LEN);
+        bench_process_ns[s] = bench_ns(start, bench_now()) / BENCH_STROKE_LEN;
+    }
+
+    bench_print_percentiles("processing ns per packet", bench_process_ns, BENCH_PROCESS_STROKES);
+}
+
+// Bus traffic of a forced calibration, most of which is spent polling for its completion
+static void bench_recalibrate(const struct bench_pad *pad) {
+    struct pinnacle_emul_stats bus;
+
+    pinnacle_emul_reset_stats(pad->emul);
+
+    int ret = pinnacle_recalibrate(pad->dev);
+
+    pinnacle_emul_get_stats(pad->emul, &bus);
+    if (ret < 0) {
+        printk("  recalibration failed (%d)\n", ret);
+        return;
+    }
+
+    printk("  recalibration: %u bus transactions, %u of them completion wait polls\n",
+           bus.transactions, bus.wait_polls);
+}
+
+// One register block read per call, to compare direct bus calls with runtime dispatch
+static void bench_register_reads(const struct bench_pad *pad) {
+    for (size_t i = 0; i < BENCH_REG_READS; i++) {
+        bench_time_t start = bench_now();
+
+        pinnacle_resync(pad->dev);
+        bench_access_ns[i] = bench_ns(start, bench_now());
+    }
+
+    bench_print_percentiles("register block read ns", bench_access_ns, BENCH_REG_READS);
+}
+
+static void bench_pad(const struct bench_pad *pad) {
+    const struct pinnacle_config *config = pad->dev->config;
+
+    printk("%s (%s%s%s)\n", pad->dev->name, config->burst_read ? "burst read" : "separate reads",
+           config->accel_curve_len ? ", accel curve" : "",
+           config->absolute ? ", absolute with gestures" : "");
+
+    bench_recalibrate(pad);
+
+    // The report path pushes relative packets, so absolute pads only get the processing part
+    if (config->absolute) {
+        bench_process(pad, bench_abs_stroke_packet);
+        return;
+    }
+
+    bench_report_path(pad);
+    bench_config_writes(pad);
+    bench_register_reads(pad);
+    bench_process(pad, bench_rel_sweep_packet);
+}
+
+int main(void) {
+    if (!bench_boot()) {
+        return 0;
+    }
+
+    printk("bus ops: %s\n", PINNACLE_BUS_MIXED ? "runtime dispatch" : "direct calls");
+
+    for (size_t i = 0; i < ARRAY_SIZE(bench_pads); i++) {
+        bench_pad(&bench_pads[i]);
+    }
+
+    printk("bench done\n");
+    return 0;
+}
@@ -0,0 +1,177 @@
+#include <zephyr/device.h>
+#include <zephyr/input/input.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#include "input_pinnacle.h"
+
+#define REPLAY_RUNS 2
+#define REPLAY_TIMED_RUNS 100
+#define REPLAY_EVENTS_MAX 512
+#define REPLAY_READY_TIMEOUT K_SECONDS(1)
+
+static const uint8_t replay_records[] = {
+#ifdef REPLAY_TRACE_INC
+#include REPLAY_TRACE_INC
+#else
+#include "trace.inc"
+#endif
+};
+
+BUILD_ASSERT(sizeof(replay_records) % PINNACLE_TRACE_RECORD_LEN == 0,
+             "Trace must hold whole PINNACLE_TRACE_RECORD_LEN byte records");
+
+#define REPLAY_ENTRIES (sizeof(replay_records) / PINNACLE_TRACE_RECORD_LEN)
+
+// A captured trace comes with its own expected events, if any, since the bundled ones won't match
+#if defined(REPLAY_EXPECTED_INC) || !defined(REPLAY_TRACE_INC)
+#define REPLAY_CHECK_EXPECTED 1
+
+static const struct input_event replay_expected[] = {
+#ifdef REPLAY_EXPECTED_INC
+#include REPLAY_EXPECTED_INC
+#else
+#include "expected.inc"
+#endif
+};
+#endif
+
+static const struct device *const replay_dev = DEVICE_DT_GET(DT_NODELABEL(trackpad));
+
+static struct pinnacle_trace_entry replay_entries[REPLAY_ENTRIES];
+
+struct replay_run {
+    struct input_event events[REPLAY_EVENTS_MAX];
+    size_t count;
+    size_t dropped;
+};
+
+static struct replay_run replay_runs[REPLAY_RUNS];
+static struct replay_run *replay_capture;
+
+static void replay_input_cb(struct input_event *evt, void *user_data) {
+    ARG_UNUSED(user_data);
+
+    if (!replay_capture) {
+        return;
+    }
+
+    if (replay_capture->count < REPLAY_EVENTS_MAX) {
+        replay_capture->events[replay_capture->count++] = *evt;
+    } else {
+        replay_capture->dropped++;
+    }
+}
+
+INPUT_CALLBACK_DEFINE(DEVICE_DT_GET(DT_NODELABEL(trackpad)), replay_input_cb, NULL);
+
+static bool replay_event_eq(const struct input_event *a, const struct input_event *b) {
+    return a->sync == b->sync && a->type == b->type && a->code == b->code && a->value == b->value;
+}
+
+static void replay_print_events(const struct replay_run *run) {
+    for (size_t i = 0; i < run->count; i++) {
+        const struct input_event *evt = &run->events[i];
+
+        printk("  type %u code %u value %d%s\n", evt->type, evt->code, evt->value,
+               evt->sync ? " sync" : "");
+    }
+}
+
+// Index of the first event where the lists differ, or -1 if they are identical
+static int replay_compare(const struct input_event *a, size_t a_count,
+                          const struct input_event *b, size_t b_count) {
+    size_t n = MIN(a_count, b_count);
+
+    for (size_t i = 0; i < n; i++) {
+        if (!replay_event_eq(&a[i], &b[i])) {
+            return i;
+        }
+    }
+
+    return a_count == b_count ? -1 : (int)n;
+}
+
+// Replay throughput without capturing, over enough runs to amortize the work queue hand-off
+static void replay_time(void) {
+    uint32_t packets = 0;
+    uint32_t start = k_cycle_get_32();
+
+    for (size_t i = 0; i < REPLAY_TIMED_RUNS; i++) {
+        packets += pinnacle_trace_replay(replay_dev, replay_entries, REPLAY_ENTRIES);
+    }
+
+    uint32_t cycles = k_cycle_get_32() - start;
+
+    // native_sim time only moves while the CPU idles, so a busy replay may take no cycles at all
+    if (cycles == 0) {
+        printk("%u packets replayed before the cycle counter advanced\n", packets);
+        return;
+    }
+
+    printk("%u packets in %u cycles, %u packets/s\n", packets, cycles,
+           (uint32_t)((uint64_t)packets * sys_clock_hw_cycles_per_sec() / cycles));
+}
+
+int main(void) {
+    int ret = pinnacle_wait_ready(replay_dev, REPLAY_READY_TIMEOUT);
+    if (ret < 0) {
+        printk("%s not ready (%d)\n", replay_dev->name, ret);
+        return 0;
+    }
+
+    for (size_t i = 0; i < REPLAY_ENTRIES; i++) {
+        pinnacle_trace_decode(&replay_records[i * PINNACLE_TRACE_RECORD_LEN], &replay_entries[i]);
+    }
+
+    int processed = 0;
+
+    for (size_t i = 0; i < REPLAY_RUNS; i++) {
+        replay_capture = &replay_runs[i];
+        processed = pinnacle_trace_replay(replay_dev, replay_entries, REPLAY_ENTRIES);
+        replay_capture = NULL;
+
+        if (processed < 0) {
+            printk("replay failed (%d)\n", processed);
+            return 0;
+        }
+
+        if (replay_runs[i].dropped) {
+            printk("run %zu dropped %zu events, raise REPLAY_EVENTS_MAX\n", i,
+                   replay_runs[i].dropped);
+            return 0;
+        }
+    }
+
+    printk("%s: %zu entries, %d packets, %zu events\n", replay_dev->name, REPLAY_ENTRIES,
+           processed, replay_runs[0].count);
+    replay_print_events(&replay_runs[0]);
+
+    for (size_t i = 1; i < REPLAY_RUNS; i++) {
+        int diff = replay_compare(replay_runs[0].events, replay_runs[0].count,
+                                  replay_runs[i].events, replay_runs[i].count);
+
+        if (diff >= 0) {
+            printk("run %zu differs from run 0 at event %d\n", i, diff);
+            return 0;
+        }
+    }
+
+#ifdef REPLAY_CHECK_EXPECTED
+    int diff = replay_compare(replay_expected, ARRAY_SIZE(replay_expected), replay_runs[0].events,
+                              replay_runs[0].count);
+
+    if (diff >= 0) {
+        printk("events differ from the expected %zu at event %d\n", ARRAY_SIZE(replay_expected),
+               diff);
+        return 0;
+    }
+#else
+    printk("no expected events given, only the runs were compared\n");
+#endif
+
+    replay_time();
+
+    printk("replay done\n");
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "pinnacle_test.h"
+
+static const struct device *const test_bus = DEVICE_DT_GET(DT_BUS(TEST_PAD));
+
+#define TEST_ASYNC_PACKETS 8
+
+// Status read, packet read and status clear each complete through the callback
+ZTEST(pinnacle_async, test_chain_from_thread_context) {
+    const struct pinnacle_config *config = test_dev->config;
+    uint32_t steps = config->burst_read ? 2 : 3;
+    struct pinnacle_test_i2c_stats before, after;
+
+    pinnacle_test_i2c_get_stats(test_bus, &before);
+
+    for (int i = 1; i <= TEST_ASYNC_PACKETS; i++) {
+        zassert_ok(pinnacle_test_push_rel(i, -i, 0, 0));
+        zassert_ok(pinnacle_test_wait_reports(1, TEST_REPORT_TIMEOUT), "no report for packet %d",
+                   i);
+    }
+
+    pinnacle_test_i2c_get_stats(test_bus, &after);
+
+    zassert_equal(after.violations, before.violations,
+                  "bus transfer started from ISR context or a completion callback");
+    zassert_equal(after.callbacks - before.callbacks, steps * TEST_ASYNC_PACKETS,
+                  "packets were not fetched through the callback chain");
+
+    // Events come out in packet order
+    int expected = 1;
+
+    for (size_t i = 0; i < test_event_count; i++) {
+        if (test_events[i].code == INPUT_REL_X) {
+            zassert_equal(test_events[i].value, expected++);
+        }
+    }
+    zassert_equal(expected, TEST_ASYNC_PACKETS + 1);
+}
+
+// A DR edge while the chain is busy is kept pending and serviced once the chain is done
+ZTEST(pinnacle_async, test_edge_during_chain) {
+    struct pinnacle_test_i2c_stats before, after;
+
+    pinnacle_test_i2c_get_stats(test_bus, &before);
+
+    zassert_ok(pinnacle_test_push_rel(1, 1, 0, 0));
+    // Drop and raise DR again before the first completion, a timer tick away
+    zassert_ok(pinnacle_emul_set_dr(test_emul, false));
+    zassert_ok(pinnacle_test_push_rel(2, 2, 0, 0));
+
+    zassert_ok(pinnacle_test_wait_reports(1, TEST_REPORT_TIMEOUT));
+    k_msleep(10);
+
+    pinnacle_test_i2c_get_stats(test_bus, &after);
+    zassert_equal(after.violations, before.violations);
+    zassert_true(test_event_count > 0);
+    // The chip overwrote the first packet, so the last report always carries the second
+    zassert_equal(test_events[test_event_count - 1].code, INPUT_REL_Y);
+    zassert_equal(test_events[test_event_count - 1].value, 2);
+    zassert_false(pinnacle_emul_reg_get(test_emul, PINNACLE_STATUS1) & PINNACLE_STATUS1_SW_DR,
+                  "pending edge was not serviced");
+}
+
+ZTEST_SUITE(pinnacle_async, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,124 @@
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/pm/device.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/ztest.h>
+
+#include "pinnacle_test.h"
+
+#define TEST_CAL_ADDR CONFIG_INPUT_PINNACLE_CAL_CACHE_ERA_ADDR
+#define TEST_CAL_LEN CONFIG_INPUT_PINNACLE_CAL_CACHE_LEN
+
+// Deferred bring-up reads the saved calibration directly, so settings must be up before it runs
+static int pinnacle_cal_cache_settings_init(void) { return settings_subsys_init(); }
+
+SYS_INIT(pinnacle_cal_cache_settings_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+static void pinnacle_cal_key(char *key, size_t len) {
+    snprintf(key, len, PINNACLE_CAL_SETTINGS_ROOT "/%s", test_dev->name);
+}
+
+static int pinnacle_cal_load_cb(const char *key, size_t len, settings_read_cb read_cb,
+                                void *cb_arg, void *param) {
+    struct pinnacle_cal_blob *blob = param;
+
+    if (len != sizeof(*blob)) {
+        return -EINVAL;
+    }
+
+    int ret = read_cb(cb_arg, blob, sizeof(*blob));
+    return ret < 0 ? ret : 0;
+}
+
+static void pinnacle_cal_load(struct pinnacle_cal_blob *blob) {
+    char key[64];
+
+    memset(blob, 0, sizeof(*blob));
+    pinnacle_cal_key(key, sizeof(key));
+    zassert_ok(settings_load_subtree_direct(key, pinnacle_cal_load_cb, blob));
+    zassert_equal(blob->fw_id[0], pinnacle_emul_reg_get(test_emul, PINNACLE_FW_ID),
+                  "no calibration saved");
+}
+
+static void pinnacle_cal_fill(uint8_t base) {
+    for (int i = 0; i < TEST_CAL_LEN; i++) {
+        zassert_ok(pinnacle_emul_era_set(test_emul, TEST_CAL_ADDR + i, base + i));
+    }
+}
+
+static void pinnacle_cal_check(uint8_t base) {
+    for (int i = 0; i < TEST_CAL_LEN; i++) {
+        uint8_t val;
+
+        zassert_ok(pinnacle_emul_era_get(test_emul, TEST_CAL_ADDR + i, &val));
+        zassert_equal(val, (uint8_t)(base + i), "ERA 0x%04x is 0x%02x", TEST_CAL_ADDR + i, val);
+    }
+}
+
+// Runs bring-up again through device PM, which is where the saved calibration is restored
+static void pinnacle_cal_power_cycle(void) {
+    zassert_ok(pm_device_action_run(test_dev, PM_DEVICE_ACTION_SUSPEND));
+    zassert_ok(pm_device_action_run(test_dev, PM_DEVICE_ACTION_TURN_OFF));
+    zassert_ok(pm_device_action_run(test_dev, PM_DEVICE_ACTION_TURN_ON));
+    zassert_ok(pm_device_action_run(test_dev, PM_DEVICE_ACTION_RESUME));
+}
+
+static void pinnacle_cal_cache_before(void *fixture) {
+    ARG_UNUSED(fixture);
+
+    // Stand-in compensation data, saved by a fresh calibration
+    pinnacle_cal_fill(0x40);
+    zassert_ok(pinnacle_recalibrate(test_dev));
+    pinnacle_emul_reset_stats(test_emul);
+}
+
+ZTEST(pinnacle_cal_cache, test_save) {
+    struct pinnacle_cal_blob blob;
+
+    pinnacle_cal_load(&blob);
+
+    zassert_equal(blob.fw_id[1], pinnacle_emul_reg_get(test_emul, PINNACLE_FW_VER));
+    zassert_equal(blob.crc, crc32_ieee((const uint8_t *)&blob, offsetof(typeof(blob), crc)));
+    for (int i = 0; i < TEST_CAL_LEN; i++) {
+        zassert_equal(blob.comp[i], 0x40 + i);
+    }
+}
+
+ZTEST(pinnacle_cal_cache, test_restore) {
+    struct pinnacle_emul_stats stats;
+
+    // What the ASIC holds after losing power
+    pinnacle_cal_fill(0x90);
+    pinnacle_cal_power_cycle();
+
+    pinnacle_emul_get_stats(test_emul, &stats);
+    zassert_equal(stats.calibrations, 0, "calibrated instead of restoring");
+    pinnacle_cal_check(0x40);
+}
+
+ZTEST(pinnacle_cal_cache, test_crc_reject) {
+    struct pinnacle_cal_blob blob;
+    struct pinnacle_emul_stats stats;
+    char key[64];
+
+    // Corrupt the saved data but keep its old CRC
+    pinnacle_cal_load(&blob);
+    blob.comp[0] ^= 0xFF;
+    pinnacle_cal_key(key, sizeof(key));
+    zassert_ok(settings_save_one(key, &blob, sizeof(blob)));
+
+    pinnacle_cal_fill(0x90);
+    pinnacle_cal_power_cycle();
+
+    pinnacle_emul_get_stats(test_emul, &stats);
+    zassert_equal(stats.calibrations, 1, "corrupt calibration was not rejected");
+    pinnacle_cal_check(0x90);
+
+    // The fresh calibration replaced the corrupt save
+    pinnacle_cal_load(&blob);
+    zassert_equal(blob.crc, crc32_ieee((const uint8_t *)&blob, offsetof(typeof(blob), crc)));
+    zassert_equal(blob.comp[0], 0x90);
+}
+
+ZTEST_SUITE(pinnacle_cal_cache, NULL, NULL, pinnacle_cal_cache_before, NULL, NULL);
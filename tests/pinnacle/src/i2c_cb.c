@@ -0,0 +1,131 @@
+#define DT_DRV_COMPAT zmk_pinnacle_test_i2c
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/kernel.h>
+
+#include "pinnacle_test.h"
+
+// Completion comes this long after the transfer was started
+#define TEST_I2C_COMPLETION_DELAY K_USEC(100)
+
+struct test_i2c_data {
+    const struct device *dev;
+    struct k_timer timer;
+    i2c_callback_t cb;
+    void *userdata;
+    int result;
+    bool busy, in_cb;
+    struct pinnacle_test_i2c_stats stats;
+};
+
+struct test_i2c_config {
+    const struct emul *const *targets;
+    size_t target_count;
+};
+
+static int test_i2c_configure(const struct device *dev, uint32_t dev_config) {
+    ARG_UNUSED(dev);
+    ARG_UNUSED(dev_config);
+
+    return 0;
+}
+
+static int test_i2c_transfer(const struct device *dev, struct i2c_msg *msgs, uint8_t num_msgs,
+                             uint16_t addr) {
+    const struct test_i2c_config *config = dev->config;
+    struct test_i2c_data *data = dev->data;
+
+    // Real controllers take a lock here that can't be taken in either context
+    if (k_is_in_isr() || data->in_cb) {
+        data->stats.violations++;
+    }
+
+    for (size_t i = 0; i < config->target_count; i++) {
+        const struct emul *target = config->targets[i];
+
+        if (target->bus.i2c->addr == addr) {
+            return target->bus.i2c->api->transfer(target, msgs, num_msgs, addr);
+        }
+    }
+
+    return -EIO;
+}
+
+static void test_i2c_timer_cb(struct k_timer *timer) {
+    struct test_i2c_data *data = CONTAINER_OF(timer, struct test_i2c_data, timer);
+    i2c_callback_t cb = data->cb;
+
+    data->busy = false;
+    data->stats.callbacks++;
+    data->in_cb = true;
+    cb(data->dev, data->result, data->userdata);
+    data->in_cb = false;
+}
+
+static int test_i2c_transfer_cb(const struct device *dev, struct i2c_msg *msgs,
+                                uint8_t num_msgs, uint16_t addr, i2c_callback_t cb,
+                                void *userdata) {
+    struct test_i2c_data *data = dev->data;
+
+    if (data->busy) {
+        data->stats.violations++;
+        return -EBUSY;
+    }
+
+    data->busy = true;
+    data->cb = cb;
+    data->userdata = userdata;
+    data->result = test_i2c_transfer(dev, msgs, num_msgs, addr);
+    k_timer_start(&data->timer, TEST_I2C_COMPLETION_DELAY, K_NO_WAIT);
+
+    return 0;
+}
+
+static const struct i2c_driver_api test_i2c_api = {
+    .configure = test_i2c_configure,
+    .transfer = test_i2c_transfer,
+    .transfer_cb = test_i2c_transfer_cb,
+};
+
+void pinnacle_test_i2c_get_stats(const struct device *bus, struct pinnacle_test_i2c_stats *stats) {
+    struct test_i2c_data *data = bus->data;
+
+    *stats = data->stats;
+}
+
+static int test_i2c_init(const struct device *dev) {
+    const struct test_i2c_config *config = dev->config;
+    struct test_i2c_data *data = dev->data;
+
+    data->dev = dev;
+    k_timer_init(&data->timer, test_i2c_timer_cb, NULL);
+
+    for (size_t i = 0; i < config->target_count; i++) {
+        const struct emul *target = config->targets[i];
+        int ret = target->init(target, dev);
+
+        if (ret < 0) {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
+#define TEST_I2C_TARGET(node_id) EMUL_DT_GET(node_id),
+
+#define TEST_I2C_INST(n)                                                                           \
+    static const struct emul *const test_i2c_targets_##n[] = {                                     \
+        DT_INST_FOREACH_CHILD_STATUS_OKAY(n, TEST_I2C_TARGET)};                                    \
+    static struct test_i2c_data test_i2c_data_##n;                                                 \
+    static const struct test_i2c_config test_i2c_config_##n = {                                    \
+        .targets = test_i2c_targets_##n,                                                           \
+        .target_count = ARRAY_SIZE(test_i2c_targets_##n),                                          \
+    };                                                                                             \
+    DEVICE_DT_INST_DEFINE(n, test_i2c_init, NULL, &test_i2c_data_##n, &test_i2c_config_##n,        \
+                          POST_KERNEL, CONFIG_I2C_INIT_PRIORITY, &test_i2c_api);
+
+DT_INST_FOREACH_STATUS_OKAY(TEST_I2C_INST)
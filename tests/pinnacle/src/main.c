@@ -0,0 +1,111 @@
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "pinnacle_test.h"
+
+const struct device *const test_dev = DEVICE_DT_GET(TEST_PAD);
+const struct emul *const test_emul = EMUL_DT_GET(TEST_PAD);
+
+struct input_event test_events[TEST_EVENTS_MAX];
+size_t test_event_count;
+
+static K_SEM_DEFINE(test_report_sem, 0, TEST_EVENTS_MAX);
+
+static void test_input_cb(struct input_event *evt, void *user_data) {
+    ARG_UNUSED(user_data);
+
+    if (test_event_count < ARRAY_SIZE(test_events)) {
+        test_events[test_event_count++] = *evt;
+    }
+
+    if (evt->sync) {
+        k_sem_give(&test_report_sem);
+    }
+}
+
+// Every pad is captured, so tests driving a second pad see its events too
+INPUT_CALLBACK_DEFINE(NULL, test_input_cb, NULL);
+
+static void pinnacle_test_reset(const struct ztest_unit_test *test, void *fixture) {
+    ARG_UNUSED(test);
+    ARG_UNUSED(fixture);
+
+    zassert_ok(pinnacle_wait_ready(test_dev, K_SECONDS(2)), "pad not ready");
+
+    // Let anything still in flight from the previous test land before clearing
+    k_msleep(10);
+    test_event_count = 0;
+    k_sem_reset(&test_report_sem);
+    pinnacle_emul_reset_stats(test_emul);
+}
+
+// Runs ahead of every suite's own before hook, so each test starts from a ready, quiet pad
+ZTEST_RULE(pinnacle_reset, pinnacle_test_reset, NULL);
+
+void pinnacle_test_rel_packet(uint8_t *packet, int8_t dx, int8_t dy, int8_t wheel,
+                              uint8_t buttons) {
+    packet[0] =
+        buttons | (dx < 0 ? PINNACLE_PACKET0_X_SIGN : 0) | (dy < 0 ? PINNACLE_PACKET0_Y_SIGN : 0);
+    packet[1] = (uint8_t)dx;
+    packet[2] = (uint8_t)dy;
+    packet[3] = (uint8_t)wheel;
+}
+
+int pinnacle_test_push_rel_to(const struct emul *emul, int8_t dx, int8_t dy, int8_t wheel,
+                              uint8_t buttons) {
+    uint8_t packet[PINNACLE_REL_PACKET_LEN];
+
+    pinnacle_test_rel_packet(packet, dx, dy, wheel, buttons);
+    return pinnacle_emul_push_packet(emul, packet, sizeof(packet));
+}
+
+int pinnacle_test_push_rel(int8_t dx, int8_t dy, int8_t wheel, uint8_t buttons) {
+    return pinnacle_test_push_rel_to(test_emul, dx, dy, wheel, buttons);
+}
+
+int pinnacle_test_wait_reports(size_t count, k_timeout_t timeout) {
+    for (size_t i = 0; i < count; i++) {
+        if (k_sem_take(&test_report_sem, timeout) < 0) {
+            return -EAGAIN;
+        }
+    }
+
+    return 0;
+}
+
+int32_t pinnacle_test_sum(uint8_t type, uint16_t code) {
+    int32_t sum = 0;
+
+    for (size_t i = 0; i < test_event_count; i++) {
+        if (test_events[i].type == type && test_events[i].code == code) {
+            sum += test_events[i].value;
+        }
+    }
+
+    return sum;
+}
+
+ZTEST(pinnacle, test_rel_motion) {
+    zassert_ok(pinnacle_test_push_rel(5, -3, 0, 0));
+    zassert_ok(pinnacle_test_wait_reports(1, TEST_REPORT_TIMEOUT));
+
+    zassert_equal(pinnacle_test_sum(INPUT_EV_REL, INPUT_REL_X), 5);
+    zassert_equal(pinnacle_test_sum(INPUT_EV_REL, INPUT_REL_Y), -3);
+    zassert_false(pinnacle_emul_reg_get(test_emul, PINNACLE_STATUS1) & PINNACLE_STATUS1_SW_DR,
+                  "SW_DR not cleared after the report");
+}
+
+ZTEST(pinnacle, test_button_edges) {
+    zassert_ok(pinnacle_test_push_rel(0, 0, 0, PINNACLE_PACKET0_BTN_PRIM));
+    zassert_ok(pinnacle_test_wait_reports(1, TEST_REPORT_TIMEOUT));
+    zassert_ok(pinnacle_test_push_rel(0, 0, 0, 0));
+    zassert_ok(pinnacle_test_wait_reports(1, TEST_REPORT_TIMEOUT));
+
+    zassert_equal(test_event_count, 2);
+    zassert_equal(test_events[0].code, INPUT_BTN_0);
+    zassert_equal(test_events[0].value, 1);
+    zassert_equal(test_events[1].code, INPUT_BTN_0);
+    zassert_equal(test_events[1].value, 0);
+}
+
+ZTEST_SUITE(pinnacle, NULL, NULL, NULL, NULL, NULL);
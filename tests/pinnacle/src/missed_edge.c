@@ -0,0 +1,70 @@
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "pinnacle_test.h"
+
+// Queues a packet behind the current one; it lands when SW_DR is cleared, without a DR edge
+static void pinnacle_test_queue_rel(int8_t dx, int8_t dy) {
+    uint8_t packet[PINNACLE_REL_PACKET_LEN];
+
+    pinnacle_test_rel_packet(packet, dx, dy, 0, 0);
+    zassert_ok(pinnacle_emul_queue_packet(test_emul, packet, sizeof(packet)));
+}
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_DRAIN)
+ZTEST(pinnacle_missed_edge, test_drain_reads_edgeless_packets) {
+    struct pinnacle_dr_stats before, after;
+
+    zassert_ok(pinnacle_get_dr_stats(test_dev, &before));
+
+    // Queued first, so all three are in place before the one edge the driver gets
+    pinnacle_test_queue_rel(2, 0);
+    pinnacle_test_queue_rel(3, 0);
+    zassert_ok(pinnacle_test_push_rel(1, 0, 0, 0));
+    zassert_ok(pinnacle_test_wait_reports(3, TEST_REPORT_TIMEOUT));
+
+    zassert_ok(pinnacle_get_dr_stats(test_dev, &after));
+    zassert_equal(after.drained - before.drained, 2);
+    zassert_equal(test_event_count, 3);
+    zassert_equal(test_events[0].value, 1);
+    zassert_equal(test_events[1].value, 2);
+    zassert_equal(test_events[2].value, 3);
+    zassert_false(pinnacle_emul_reg_get(test_emul, PINNACLE_STATUS1) & PINNACLE_STATUS1_SW_DR,
+                  "SW_DR still set after draining");
+}
+#endif
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_DR_WATCHDOG) && !IS_ENABLED(CONFIG_INPUT_PINNACLE_DRAIN)
+ZTEST(pinnacle_missed_edge, test_watchdog_recovers_stuck_dr) {
+    struct pinnacle_dr_stats before, after;
+
+    zassert_ok(pinnacle_get_dr_stats(test_dev, &before));
+
+    pinnacle_test_queue_rel(2, 0);
+    zassert_ok(pinnacle_test_push_rel(1, 0, 0, 0));
+    zassert_ok(pinnacle_test_wait_reports(1, TEST_REPORT_TIMEOUT));
+
+    // The queued packet raised no edge, so DR is held asserted with nobody reading
+    k_msleep(1);
+    zassert_true(pinnacle_emul_reg_get(test_emul, PINNACLE_STATUS1) & PINNACLE_STATUS1_SW_DR,
+                 "queued packet did not land");
+
+    // The watchdog reads the stuck packet instead of dropping it
+    zassert_ok(pinnacle_test_wait_reports(1, K_MSEC(CONFIG_INPUT_PINNACLE_DR_WATCHDOG_MS * 2)));
+    zassert_equal(test_event_count, 2);
+    zassert_equal(test_events[1].code, INPUT_REL_X);
+    zassert_equal(test_events[1].value, 2);
+
+    zassert_ok(pinnacle_get_dr_stats(test_dev, &after));
+    zassert_equal(after.recoveries - before.recoveries, 1);
+    zassert_false(pinnacle_emul_reg_get(test_emul, PINNACLE_STATUS1) & PINNACLE_STATUS1_SW_DR,
+                  "DR still stuck after the watchdog");
+
+    // Edges work again after the resync
+    zassert_ok(pinnacle_test_push_rel(4, 0, 0, 0));
+    zassert_ok(pinnacle_test_wait_reports(1, TEST_REPORT_TIMEOUT));
+    zassert_equal(test_events[test_event_count - 1].value, 4);
+}
+#endif
+
+ZTEST_SUITE(pinnacle_missed_edge, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/input/input.h>
+
+#include "input_pinnacle.h"
+#include "input_pinnacle_emul.h"
+
+#define TEST_PAD DT_NODELABEL(trackpad)
+// Second pad with non-default scroll options, only present in some scenarios
+#define TEST_SCROLL_PAD DT_NODELABEL(trackpad_scroll)
+#define TEST_EVENTS_MAX 64
+#define TEST_REPORT_TIMEOUT K_MSEC(100)
+
+extern const struct device *const test_dev;
+extern const struct emul *const test_emul;
+
+// Every input event from the pad since the current test started, in emission order
+extern struct input_event test_events[TEST_EVENTS_MAX];
+extern size_t test_event_count;
+
+/*
+ * Before every test in every suite a ZTEST_RULE waits for the pad, then drops captured events
+ * and emulator counters, so suites need no before hook of their own for that.
+ */
+
+// Builds a PINNACLE_REL_PACKET_LEN byte relative packet
+void pinnacle_test_rel_packet(uint8_t *packet, int8_t dx, int8_t dy, int8_t wheel,
+                              uint8_t buttons);
+
+// Loads a relative packet into the emulator and raises DR
+int pinnacle_test_push_rel_to(const struct emul *emul, int8_t dx, int8_t dy, int8_t wheel,
+                              uint8_t buttons);
+int pinnacle_test_push_rel(int8_t dx, int8_t dy, int8_t wheel, uint8_t buttons);
+
+// Waits for count more synced reports; returns 0 or -EAGAIN on timeout
+int pinnacle_test_wait_reports(size_t count, k_timeout_t timeout);
+
+// Sum of all captured values for an event type and code
+int32_t pinnacle_test_sum(uint8_t type, uint16_t code);
+
+#if IS_ENABLED(CONFIG_INPUT_PINNACLE_ASYNC)
+struct pinnacle_test_i2c_stats {
+    uint32_t callbacks;  // callback transfers completed
+    uint32_t violations; // transfers started from ISR context or from inside a callback
+};
+
+void pinnacle_test_i2c_get_stats(const struct device *bus, struct pinnacle_test_i2c_stats *stats);
+#endif
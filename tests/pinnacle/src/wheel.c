@@ -0,0 +1,62 @@
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "pinnacle_test.h"
+
+ZTEST(pinnacle_wheel, test_wheel_counts) {
+    zassert_ok(pinnacle_test_push_rel(0, 0, 3, 0));
+    zassert_ok(pinnacle_test_wait_reports(1, TEST_REPORT_TIMEOUT));
+    zassert_ok(pinnacle_test_push_rel(0, 0, -5, 0));
+    zassert_ok(pinnacle_test_wait_reports(1, TEST_REPORT_TIMEOUT));
+
+    zassert_equal(test_event_count, 2);
+    zassert_equal(test_events[0].code, INPUT_REL_WHEEL);
+    zassert_equal(test_events[0].value, 3);
+    zassert_equal(test_events[1].code, INPUT_REL_WHEEL);
+    zassert_equal(test_events[1].value, -5);
+}
+
+ZTEST(pinnacle_wheel, test_wheel_with_motion) {
+    zassert_ok(pinnacle_test_push_rel(4, -2, 1, 0));
+    zassert_ok(pinnacle_test_wait_reports(1, TEST_REPORT_TIMEOUT));
+
+    // One report: X and Y unsynced, the wheel closes it
+    zassert_equal(test_event_count, 3);
+    zassert_equal(pinnacle_test_sum(INPUT_EV_REL, INPUT_REL_X), 4);
+    zassert_equal(pinnacle_test_sum(INPUT_EV_REL, INPUT_REL_Y), -2);
+    zassert_equal(pinnacle_test_sum(INPUT_EV_REL, INPUT_REL_WHEEL), 1);
+    zassert_false(test_events[0].sync);
+    zassert_false(test_events[1].sync);
+    zassert_true(test_events[2].sync);
+}
+
+#if DT_NODE_EXISTS(TEST_SCROLL_PAD)
+ZTEST(pinnacle_wheel, test_scroll_options) {
+    const struct emul *emul = EMUL_DT_GET(TEST_SCROLL_PAD);
+
+    zassert_ok(pinnacle_wait_ready(DEVICE_DT_GET(TEST_SCROLL_PAD), K_SECONDS(2)));
+
+    // Inverted and halved: 3 counts make one step and carry the third into the next packet
+    zassert_ok(pinnacle_test_push_rel_to(emul, 0, 0, 3, 0));
+    zassert_ok(pinnacle_test_wait_reports(1, TEST_REPORT_TIMEOUT));
+    zassert_ok(pinnacle_test_push_rel_to(emul, 0, 0, 1, 0));
+    zassert_ok(pinnacle_test_wait_reports(1, TEST_REPORT_TIMEOUT));
+
+    zassert_equal(pinnacle_test_sum(INPUT_EV_REL, INPUT_REL_HWHEEL), -2);
+    zassert_equal(pinnacle_test_sum(INPUT_EV_REL, INPUT_REL_WHEEL), 0);
+}
+
+ZTEST(pinnacle_wheel, test_scroll_invert_full_scale) {
+    const struct emul *emul = EMUL_DT_GET(TEST_SCROLL_PAD);
+
+    zassert_ok(pinnacle_wait_ready(DEVICE_DT_GET(TEST_SCROLL_PAD), K_SECONDS(2)));
+
+    // -128 has no int8_t negation, so it must still flip direction when inverted
+    zassert_ok(pinnacle_test_push_rel_to(emul, 0, 0, INT8_MIN, 0));
+    zassert_ok(pinnacle_test_wait_reports(1, TEST_REPORT_TIMEOUT));
+
+    zassert_equal(pinnacle_test_sum(INPUT_EV_REL, INPUT_REL_HWHEEL), 64);
+}
+#endif
+
+ZTEST_SUITE(pinnacle_wheel, NULL, NULL, NULL, NULL, NULL);